@@ -1,9 +1,37 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <queue>
+#include <thread>
 #include <tuple>
 #include <vector>
+#include "classes/BitGrid/BitGrid.hpp"
+#include "classes/BucketQueue/BucketQueue.hpp"
+#include "classes/ChunkHierarchy/ChunkHierarchy.hpp"
+#include "classes/CombinedMapView/CombinedMapView.hpp"
+#include "classes/ComponentLabels/ComponentLabels.hpp"
+#include "classes/ContractionHierarchy/ContractionHierarchy.hpp"
+#include "classes/CorridorGraph/CorridorGraph.hpp"
 #include "classes/DijkstraMap/DijkstraMap.hpp"
+#include "classes/DistanceMatrix/DistanceMatrix.hpp"
+#include "classes/FlowField/FlowField.hpp"
+#include "classes/HierarchicalDijkstraMap/HierarchicalDijkstraMap.hpp"
+#include "classes/InfluenceMap/InfluenceMap.hpp"
+#include "classes/JumpPointGrid/JumpPointGrid.hpp"
+#include "classes/LandmarkIndex/LandmarkIndex.hpp"
+#include "classes/MultiDijkstraMap/MultiDijkstraMap.hpp"
+#include "classes/NearestGoalsMap/NearestGoalsMap.hpp"
+#include "classes/PathDatabase/PathDatabase.hpp"
+#include "classes/RectangleDecomposition/RectangleDecomposition.hpp"
+#include "classes/SearchWorkspace/SearchWorkspace.hpp"
+#include "classes/SettleOrder/SettleOrder.hpp"
 
 namespace DijkstraMapLib
 {
@@ -13,26 +41,190 @@ namespace DijkstraMapLib
 
     // Type alias for priority queue entries: (distance, x, y)
     using QueueEntry = std::tuple<int, int, int>;
+    using PriorityQueue = std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>>;
+
+    /**
+     * @brief Horizontal run of tiles [xBegin, xEnd) on row y
+     */
+    struct TileSpan
+    {
+        int y;
+        int xBegin;
+        int xEnd;
+    };
+
+    /**
+     * @brief Algorithms available to generateDijkstraMap
+     */
+    enum class GenerationEngine
+    {
+        FloodFill,          // Dijkstra flood fill over a priority queue (all distance types)
+        EuclideanTransform, // Straight-line distances, bending around walls (DistanceType::Euclidean only)
+        ChamferSweep        // Raster sweeps until stable, same result as FloodFill (all distance types)
+    };
+
+    /**
+     * @brief Settings of generateWeightedDijkstraMapBySweeping
+     */
+    struct SweepOptions
+    {
+        int maxIterations = 100;  // Iterations (four sweeps each) before giving up
+    };
+
+    /**
+     * @brief Outcome of generateWeightedDijkstraMapBySweeping
+     */
+    struct SweepResult
+    {
+        int iterations;  // Iterations run
+        bool converged;  // True if the last iteration changed nothing, so distances are exact
+    };
+
+    /**
+     * @brief Source of influence for generateInfluenceMap
+     */
+    struct InfluenceSource
+    {
+        int x;
+        int y;
+        double strength;  // Influence on the source tile; negative for opposing influence
+    };
+
+    /**
+     * @brief Shapes of the influence falloff
+     */
+    enum class FalloffType
+    {
+        Linear,      // Falls from full strength at the source to 0 at the cutoff
+        Exponential  // Halves every halfLife distance units
+    };
+
+    /**
+     * @brief Settings of generateInfluenceMap
+     *
+     * Distances are in the units of the map's distance type, e.g. 1000 per
+     * straight step for DistanceType::Octile.
+     */
+    struct InfluenceFalloff
+    {
+        FalloffType type = FalloffType::Exponential;
+        int cutoff = 10;        // Largest distance a source reaches
+        double halfLife = 3.0;  // Exponential only: distance over which influence halves; 0 or less keeps it on the source
+    };
 
     namespace detail
     {
+        /**
+         * @brief Check whether a distance type moves diagonally
+         * @param distType The distance type to check
+         * @return True for 8-directional movement, false for 4-directional
+         */
+        inline bool usesDiagonalMovement(DistanceType distType)
+        {
+            return distType == DistanceType::Chebyshev || distType == DistanceType::Octile;
+        }
+
         /**
          * @brief Get movement directions based on distance type
          * @param distType The distance type determining movement pattern
          * @return Vector of direction offsets (dx, dy)
          */
         inline const CoordList& getDirections(DistanceType distType)
+        {
+            static const CoordList& eightDirectional = DijkstraMap::getMovementDirections();
+            static const CoordList fourDirectional(eightDirectional.begin(), eightDirectional.begin() + 4);
+
+            return usesDiagonalMovement(distType) ? eightDirectional : fourDirectional;
+        }
+
+        /**
+         * @brief Get the cost of one step in each movement direction
+         * @param distType The distance type determining step costs
+         * @return Step costs, index-aligned with getDirections(distType)
+         */
+        inline const std::vector<int>& getStepCosts(DistanceType distType)
+        {
+            static const std::vector<int> fourDirectional = {
+                1, 1, 1, 1
+            };
+
+            static const std::vector<int> eightDirectional = {
+                1, 1, 1, 1,
+                1, 1, 1, 1
+            };
+
+            static const std::vector<int> octile = {
+                DijkstraMap::OCTILE_ORTHOGONAL_COST, DijkstraMap::OCTILE_ORTHOGONAL_COST,
+                DijkstraMap::OCTILE_ORTHOGONAL_COST, DijkstraMap::OCTILE_ORTHOGONAL_COST,
+                DijkstraMap::OCTILE_DIAGONAL_COST, DijkstraMap::OCTILE_DIAGONAL_COST,
+                DijkstraMap::OCTILE_DIAGONAL_COST, DijkstraMap::OCTILE_DIAGONAL_COST
+            };
+
+            if (distType == DistanceType::Octile) {
+                return octile;
+            }
+            return usesDiagonalMovement(distType) ? eightDirectional : fourDirectional;
+        }
+
+        /**
+         * @brief Check whether every step of a distance type costs exactly 1
+         * @param distType The distance type to check
+         * @return True if breadth-first search yields exact distances
+         */
+        inline bool hasUnitStepCosts(DistanceType distType)
+        {
+            const auto& stepCosts = getStepCosts(distType);
+            return std::all_of(stepCosts.begin(), stepCosts.end(), [](int cost) { return cost == 1; });
+        }
+
+        /**
+         * @brief Get the neighbors a row-major scan visits before the current tile
+         * @param distType The distance type determining connectivity
+         * @return Vector of direction offsets (dx, dy) pointing to earlier tiles
+         */
+        inline const CoordList& getPrecedingDirections(DistanceType distType)
         {
             static const CoordList fourDirectional = {
-                {0, 1}, {0, -1}, {1, 0}, {-1, 0}
+                {-1, 0}, {0, -1}
             };
 
             static const CoordList eightDirectional = {
-                {0, 1}, {0, -1}, {1, 0}, {-1, 0},
-                {1, 1}, {1, -1}, {-1, 1}, {-1, -1}
+                {-1, 0}, {0, -1}, {-1, -1}, {1, -1}
             };
 
-            return (distType == DistanceType::Chebyshev) ? eightDirectional : fourDirectional;
+            return usesDiagonalMovement(distType) ? eightDirectional : fourDirectional;
+        }
+
+        /**
+         * @brief Find the root of a union-find set, halving the path on the way
+         * @param parents Parent link per set element
+         * @param element Element to look up
+         * @return Root element of the set
+         */
+        inline int findRoot(std::vector<int>& parents, int element)
+        {
+            while (parents[element] != element) {
+                parents[element] = parents[parents[element]];
+                element = parents[element];
+            }
+            return element;
+        }
+
+        /**
+         * @brief Merge two union-find sets, keeping the smaller root
+         * @param parents Parent link per set element
+         * @param first Element of the first set
+         * @param second Element of the second set
+         * @return Root of the merged set
+         */
+        inline int uniteSets(std::vector<int>& parents, int first, int second)
+        {
+            const int firstRoot = findRoot(parents, first);
+            const int secondRoot = findRoot(parents, second);
+            const auto [keptRoot, mergedRoot] = std::minmax(firstRoot, secondRoot);
+
+            parents[mergedRoot] = keptRoot;
+            return keptRoot;
         }
 
         /**
@@ -46,7 +238,7 @@ namespace DijkstraMapLib
         void initializeGoals(DijkstraMap& dijkstraMap,
                            const CoordList& goals,
                            WalkableFunc isWalkable,
-                           std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>>& queue)
+                           PriorityQueue& queue)
         {
             for (const auto& [goalX, goalY] : goals) {
                 if (!dijkstraMap.isWithinBounds(goalX, goalY) || !isWalkable(goalX, goalY)) {
@@ -66,6 +258,7 @@ namespace DijkstraMapLib
          * @param currentY Current Y coordinate
          * @param dx Direction X offset
          * @param dy Direction Y offset
+         * @param movementCost Cost of the step in this direction
          * @param isWalkable Function to check walkability
          * @param queue Priority queue for processing
          * @return True if neighbor was updated
@@ -77,8 +270,9 @@ namespace DijkstraMapLib
                            int currentY,
                            int dx,
                            int dy,
+                           int movementCost,
                            WalkableFunc isWalkable,
-                           std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>>& queue)
+                           PriorityQueue& queue)
         {
             const int neighborX = currentX + dx;
             const int neighborY = currentY + dy;
@@ -87,7 +281,6 @@ namespace DijkstraMapLib
                 return false;
             }
 
-            const int movementCost = dijkstraMap.calculateDistance(currentX, currentY, neighborX, neighborY);
             const int newDistance = currentDist + movementCost;
 
             if (newDistance >= dijkstraMap.getDistance(neighborX, neighborY)) {
@@ -98,87 +291,5171 @@ namespace DijkstraMapLib
             queue.push({newDistance, neighborX, neighborY});
             return true;
         }
-    } // namespace detail
-    
-    /**
-     * @brief Generate a Dijkstra map using flood-fill from goal positions
-     *
-     * @param dijkstraMap The map to populate with distances
-     * @param goals Vector of goal positions (distance 0)
-     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
-     */
-    template<typename WalkableFunc>
-    void generateDijkstraMap(DijkstraMap& dijkstraMap,
-                           const CoordList& goals,
-                           WalkableFunc isWalkable)
-    {
-        dijkstraMap.clear();
 
-        // Priority queue for processing tiles: (distance, x, y)
-        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+        /**
+         * @brief Run the flood fill until the queue is empty
+         * @param dijkstraMap The map being populated, holding the distances of the queued tiles
+         * @param isWalkable Function to check walkability
+         * @param queue Priority queue of seeded tiles
+         */
+        template<typename WalkableFunc>
+        void propagateDistances(DijkstraMap& dijkstraMap, WalkableFunc isWalkable, PriorityQueue& queue)
+        {
+            // Get movement directions and their step costs based on distance type
+            const auto& directions = getDirections(dijkstraMap.getDistanceType());
+            const auto& stepCosts = getStepCosts(dijkstraMap.getDistanceType());
+            const int directionCount = static_cast<int>(directions.size());
 
-        // Initialize goals
-        detail::initializeGoals(dijkstraMap, goals, isWalkable, queue);
+            while (!queue.empty()) {
+                const auto [currentDist, currentX, currentY] = queue.top();
+                queue.pop();
 
-        // Get movement directions based on distance type
-        const auto& directions = detail::getDirections(dijkstraMap.getDistanceType());
+                // Skip if we've already found a better path to this tile
+                if (currentDist > dijkstraMap.getDistance(currentX, currentY)) {
+                    continue;
+                }
 
-        // Dijkstra flood-fill algorithm
-        while (!queue.empty()) {
-            const auto [currentDist, currentX, currentY] = queue.top();
-            queue.pop();
+                // Process all neighbors
+                for (int direction = 0; direction < directionCount; ++direction) {
+                    const auto [dx, dy] = directions[direction];
+                    processNeighbor(dijkstraMap, currentDist, currentX, currentY,
+                                    dx, dy, stepCosts[direction], isWalkable, queue);
+                }
+            }
+        }
 
-            // Skip if we've already found a better path to this tile
-            if (currentDist > dijkstraMap.getDistance(currentX, currentY)) {
-                continue;
+        /**
+         * @brief Spread set bits toward higher bit positions through a propagator mask
+         *
+         * Kogge-Stone occluded fill: every run of propagator bits that contains a
+         * seed is filled from the seed upward, in six shift steps.
+         *
+         * @param seeds Bits to spread from
+         * @param propagators Bits the fill may pass through
+         * @return Seeds plus every propagator bit reachable upward from them
+         */
+        inline BitGrid::Word fillTowardHighBits(BitGrid::Word seeds, BitGrid::Word propagators)
+        {
+            for (int shift = 1; shift < BitGrid::BITS_PER_WORD; shift *= 2) {
+                seeds |= propagators & (seeds << shift);
+                propagators &= propagators << shift;
             }
+            return seeds;
+        }
 
-            // Process all neighbors
-            for (const auto& [dx, dy] : directions) {
-                detail::processNeighbor(dijkstraMap, currentDist, currentX, currentY,
-                                      dx, dy, isWalkable, queue);
+        /**
+         * @brief Spread set bits toward lower bit positions through a propagator mask
+         * @param seeds Bits to spread from
+         * @param propagators Bits the fill may pass through
+         * @return Seeds plus every propagator bit reachable downward from them
+         */
+        inline BitGrid::Word fillTowardLowBits(BitGrid::Word seeds, BitGrid::Word propagators)
+        {
+            for (int shift = 1; shift < BitGrid::BITS_PER_WORD; shift *= 2) {
+                seeds |= propagators & (seeds >> shift);
+                propagators &= propagators >> shift;
             }
+            return seeds;
         }
-    }
-    
-    /**
-     * @brief Find all unreachable tiles in a map
-     *
-     * @param dijkstraMap The Dijkstra map to analyze
-     * @param isWalkable Function to determine if a tile should be walkable: bool(int x, int y)
-     * @return Vector of unreachable tile coordinates
-     */
-    template<typename WalkableFunc>
-    CoordList findUnreachableTiles(const DijkstraMap& dijkstraMap, WalkableFunc isWalkable)
-    {
-        CoordList unreachableTiles;
-        const auto [width, height] = dijkstraMap.getDimensions();
 
-        for (int x = 0; x < width; ++x) {
+        /**
+         * @brief Fill every walkable run of a row that contains a reached tile
+         * @param row Words of the row, updated in place
+         * @param walkable Walkability words of the same row
+         * @param wordCount Number of words per row
+         */
+        inline void fillRowRuns(BitGrid::Word* row, const BitGrid::Word* walkable, int wordCount)
+        {
+            constexpr int highBit = BitGrid::BITS_PER_WORD - 1;
+
+            BitGrid::Word carry = 0;
+            for (int i = 0; i < wordCount; ++i) {
+                row[i] = fillTowardHighBits(row[i] | (carry & walkable[i]), walkable[i]);
+                carry = row[i] >> highBit;
+            }
+
+            carry = 0;
+            for (int i = wordCount - 1; i >= 0; --i) {
+                row[i] = fillTowardLowBits(row[i] | ((carry << highBit) & walkable[i]), walkable[i]);
+                carry = row[i] & 1;
+            }
+        }
+
+        /**
+         * @brief Pull reached tiles from an adjacent row into a row and flood it
+         * @param row Reachability words of the row, updated in place
+         * @param neighbor Reachability words of the adjacent row, or nullptr at the map edge
+         * @param walkableRow Walkability words of the row
+         * @param wordCount Number of words per row
+         * @param diagonal Whether diagonal neighbors connect
+         * @param scratch Buffer of at least wordCount words
+         * @return True if the row gained any tile
+         */
+        inline bool relaxReachableRow(BitGrid::Word* row,
+                                      const BitGrid::Word* neighbor,
+                                      const BitGrid::Word* walkableRow,
+                                      int wordCount,
+                                      bool diagonal,
+                                      std::vector<BitGrid::Word>& scratch)
+        {
+            constexpr int highBit = BitGrid::BITS_PER_WORD - 1;
+
+            for (int i = 0; i < wordCount; ++i) {
+                BitGrid::Word spread = 0;
+                if (neighbor != nullptr) {
+                    spread = neighbor[i];
+                }
+                if (neighbor != nullptr && diagonal) {
+                    const BitGrid::Word lowerWord = (i > 0) ? neighbor[i - 1] : 0;
+                    const BitGrid::Word upperWord = (i + 1 < wordCount) ? neighbor[i + 1] : 0;
+                    spread |= (neighbor[i] << 1) | (lowerWord >> highBit)
+                            | (neighbor[i] >> 1) | (upperWord << highBit);
+                }
+                scratch[i] = row[i] | (spread & walkableRow[i]);
+            }
+
+            fillRowRuns(scratch.data(), walkableRow, wordCount);
+            if (std::equal(scratch.begin(), scratch.begin() + wordCount, row)) {
+                return false;
+            }
+
+            std::copy(scratch.begin(), scratch.begin() + wordCount, row);
+            return true;
+        }
+
+        /**
+         * @brief Index of the lowest set bit of a non-zero word (de Bruijn lookup)
+         * @param word Word with at least one set bit
+         * @return Bit index in [0, 63]
+         */
+        inline int countTrailingZeros(std::uint64_t word)
+        {
+            static constexpr int bitPositions[64] = {
+                 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+                62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+                63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+                46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+            };
+            constexpr std::uint64_t deBruijn = 0x03F79D71B4CB0A89ULL;
+            return bitPositions[((word & (~word + 1)) * deBruijn) >> 58];
+        }
+
+        /**
+         * @brief Breadth-first search from up to 64 sources at once, one bit lane per source
+         *
+         * Every tile holds a 64-bit mask of the sources that have reached it. One
+         * BFS layer for all sources is a few bitwise operations per frontier tile.
+         * Requires unit cost per step.
+         *
+         * @param dijkstraMaps Maps to populate, one per source
+         * @param sources Source positions
+         * @param firstSource Index of the source in lane 0
+         * @param sourceCount Number of sources in this batch (at most 64)
+         * @param walkable Walkability per tile, row-major
+         * @param directions Movement directions
+         */
+        inline void generateBitParallelBatch(std::vector<DijkstraMap>& dijkstraMaps,
+                                             const CoordList& sources,
+                                             int firstSource,
+                                             int sourceCount,
+                                             const std::vector<char>& walkable,
+                                             const CoordList& directions)
+        {
+            using Lanes = std::uint64_t;
+            const auto [width, height] = dijkstraMaps[firstSource].getDimensions();
+            const std::size_t tileCount = walkable.size();
+
+            std::vector<Lanes> visited(tileCount, 0);
+            std::vector<Lanes> frontier(tileCount, 0);
+            std::vector<Lanes> arriving(tileCount, 0);
+            std::vector<int> activeTiles;
+            std::vector<int> nextTiles;
+
+            for (int lane = 0; lane < sourceCount; ++lane) {
+                const auto [sourceX, sourceY] = sources[firstSource + lane];
+                if (!dijkstraMaps[firstSource].isWithinBounds(sourceX, sourceY)) {
+                    continue;
+                }
+
+                const int index = sourceY * width + sourceX;
+                if (!walkable[index]) {
+                    continue;
+                }
+                if (frontier[index] == 0) {
+                    activeTiles.push_back(index);
+                }
+                frontier[index] |= Lanes{1} << lane;
+                visited[index] |= Lanes{1} << lane;
+                dijkstraMaps[firstSource + lane].setDistance(sourceX, sourceY, 0);
+            }
+
+            for (int distance = 1; !activeTiles.empty(); ++distance) {
+                // Spread each frontier mask to the neighbors that have not seen those sources
+                nextTiles.clear();
+                for (const int index : activeTiles) {
+                    const int x = index % width;
+                    const int y = index / width;
+                    for (const auto& [dx, dy] : directions) {
+                        const int neighborX = x + dx;
+                        const int neighborY = y + dy;
+                        if (neighborX < 0 || neighborX >= width || neighborY < 0 || neighborY >= height) {
+                            continue;
+                        }
+
+                        const int neighborIndex = neighborY * width + neighborX;
+                        const Lanes fresh = frontier[index] & ~visited[neighborIndex];
+                        if (!walkable[neighborIndex] || fresh == 0) {
+                            continue;
+                        }
+                        if (arriving[neighborIndex] == 0) {
+                            nextTiles.push_back(neighborIndex);
+                        }
+                        arriving[neighborIndex] |= fresh;
+                    }
+                }
+
+                for (const int index : activeTiles) {
+                    frontier[index] = 0;
+                }
+
+                // Settle the new layer: every arriving lane gets this distance
+                for (const int index : nextTiles) {
+                    Lanes fresh = arriving[index];
+                    arriving[index] = 0;
+                    visited[index] |= fresh;
+                    frontier[index] = fresh;
+
+                    while (fresh != 0) {
+                        const int lane = countTrailingZeros(fresh);
+                        fresh &= fresh - 1;
+                        dijkstraMaps[firstSource + lane].setDistance(index % width, index / width, distance);
+                    }
+                }
+
+                activeTiles.swap(nextTiles);
+            }
+        }
+
+        /**
+         * @brief One-dimensional squared Euclidean distance transform (Felzenszwalb-Huttenlocher)
+         *
+         * Computes d[q] = min over p of ((q - p)^2 + f[p]) via the lower envelope of
+         * parabolas in linear time.
+         *
+         * @param f Input costs, n values (a huge value marks "no source")
+         * @param n Number of values
+         * @param d Output squared distances, n values
+         * @param vertices Scratch buffer of n parabola vertices
+         * @param boundaries Scratch buffer of n + 1 envelope boundaries
+         */
+        inline void squaredDistanceTransform1D(const double* f,
+                                               int n,
+                                               double* d,
+                                               int* vertices,
+                                               double* boundaries)
+        {
+            constexpr double infinity = std::numeric_limits<double>::infinity();
+            int k = 0;
+            vertices[0] = 0;
+            boundaries[0] = -infinity;
+            boundaries[1] = infinity;
+
+            auto intersect = [&](int q, int p) {
+                return ((f[q] + static_cast<double>(q) * q) - (f[p] + static_cast<double>(p) * p)) / (2.0 * (q - p));
+            };
+
+            for (int q = 1; q < n; ++q) {
+                double intersection = intersect(q, vertices[k]);
+                while (intersection <= boundaries[k]) {
+                    --k;
+                    intersection = intersect(q, vertices[k]);
+                }
+                ++k;
+                vertices[k] = q;
+                boundaries[k] = intersection;
+                boundaries[k + 1] = infinity;
+            }
+
+            k = 0;
+            for (int q = 0; q < n; ++q) {
+                while (boundaries[k + 1] < q) {
+                    ++k;
+                }
+                const double offset = q - vertices[k];
+                d[q] = offset * offset + f[vertices[k]];
+            }
+        }
+
+        /**
+         * @brief Exact Euclidean distance transform of an obstacle-free map
+         *
+         * Separable: a 1D transform down every column, then along every row.
+         *
+         * @param dijkstraMap The map to populate, already cleared
+         * @param goals Goal positions (all in bounds)
+         */
+        inline void generateSeparableEuclideanTransform(DijkstraMap& dijkstraMap, const CoordList& goals)
+        {
+            constexpr double noSource = 1e20;
+            const auto [width, height] = dijkstraMap.getDimensions();
+            const int longestSide = std::max(width, height);
+
+            // Squared distances, row-major
+            std::vector<double> squared(static_cast<std::size_t>(width) * height, noSource);
+            for (const auto& [goalX, goalY] : goals) {
+                squared[static_cast<std::size_t>(goalY) * width + goalX] = 0.0;
+            }
+
+            std::vector<double> input(longestSide);
+            std::vector<double> output(longestSide);
+            std::vector<int> vertices(longestSide);
+            std::vector<double> boundaries(longestSide + 1);
+
+            for (int x = 0; x < width; ++x) {
+                for (int y = 0; y < height; ++y) {
+                    input[y] = squared[static_cast<std::size_t>(y) * width + x];
+                }
+                squaredDistanceTransform1D(input.data(), height, output.data(), vertices.data(), boundaries.data());
+                for (int y = 0; y < height; ++y) {
+                    squared[static_cast<std::size_t>(y) * width + x] = output[y];
+                }
+            }
+
             for (int y = 0; y < height; ++y) {
-                if (isWalkable(x, y) && !dijkstraMap.isReachable(x, y)) {
-                    unreachableTiles.emplace_back(x, y);
+                double* row = squared.data() + static_cast<std::size_t>(y) * width;
+                std::copy(row, row + width, input.begin());
+                squaredDistanceTransform1D(input.data(), width, row, vertices.data(), boundaries.data());
+            }
+
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    const double distanceSquared = squared[static_cast<std::size_t>(y) * width + x];
+                    if (distanceSquared < noSource / 2) {
+                        dijkstraMap.setDistance(x, y, static_cast<int>(std::round(std::sqrt(distanceSquared))));
+                    }
                 }
             }
         }
 
-        return unreachableTiles;
-    }
-    
-    /**
-     * @brief Generate Dijkstra map from a single goal position
-     *
-     * @param dijkstraMap The map to populate
-     * @param goalX Goal X coordinate
-     * @param goalY Goal Y coordinate
-     * @param isWalkable Function to determine walkable tiles
-     */
-    template<typename WalkableFunc>
-    void generateDijkstraMapFromSingleGoal(DijkstraMap& dijkstraMap,
-                                         int goalX,
-                                         int goalY,
-                                         WalkableFunc isWalkable)
-    {
-        generateDijkstraMap(dijkstraMap, {{goalX, goalY}}, isWalkable);
+        /**
+         * @brief Check if a straight line between two tile centers crosses only walkable tiles
+         *
+         * Walks every tile the segment touches. Where it passes exactly through a
+         * corner, both tiles beside the corner must be walkable, so a line never
+         * squeezes between two diagonal walls.
+         *
+         * @param walkable Walkability grid
+         * @param x0 Start X coordinate, walkable
+         * @param y0 Start Y coordinate, walkable
+         * @param x1 End X coordinate
+         * @param y1 End Y coordinate
+         * @return True if nothing blocks the line
+         */
+        inline bool hasLineOfSight(const BitGrid& walkable, int x0, int y0, int x1, int y1)
+        {
+            const int dx = std::abs(x1 - x0);
+            const int dy = std::abs(y1 - y0);
+            const int stepX = (x1 > x0) ? 1 : -1;
+            const int stepY = (y1 > y0) ? 1 : -1;
+
+            // Sign tells whether the line leaves the current tile sideways, vertically or through a corner
+            int error = dx - dy;
+            int x = x0;
+            int y = y0;
+            for (int remaining = dx + dy; remaining > 0; --remaining) {
+                if (error > 0) {
+                    x += stepX;
+                    error -= 2 * dy;
+                } else if (error < 0) {
+                    y += stepY;
+                    error += 2 * dx;
+                } else {
+                    if (!walkable.get(x + stepX, y) || !walkable.get(x, y + stepY)) {
+                        return false;
+                    }
+                    x += stepX;
+                    y += stepY;
+                    error += 2 * (dx - dy);
+                    --remaining;
+                }
+                if (!walkable.get(x, y)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Euclidean distance transform around walls by line-of-sight anchors
+         *
+         * A Dijkstra flood fill over real path lengths where every tile keeps its
+         * goal and an anchor: the tile its path last bent at. A tile reached from
+         * a neighbor takes the first of the neighbor's goal, the neighbor's
+         * anchor and the neighbor itself that it can see, so tiles that see
+         * their goal get the exact straight-line distance and tiles behind walls
+         * the length of a path bending at corners, never longer than any
+         * 8-directional path. Line checks make it slower than the flood fill.
+         *
+         * @param dijkstraMap The map to populate, already cleared
+         * @param goals Goal positions (all in bounds and walkable)
+         * @param walkable Walkability grid of the map
+         */
+        inline void generateVisibilityEuclideanTransform(DijkstraMap& dijkstraMap,
+                                                         const CoordList& goals,
+                                                         const BitGrid& walkable)
+        {
+            using LengthEntry = std::tuple<double, int>;
+
+            const auto [width, height] = dijkstraMap.getDimensions();
+            const auto& directions = getDirections(DistanceType::Octile);
+            std::vector<double> lengths(static_cast<std::size_t>(width) * height, std::numeric_limits<double>::infinity());
+            std::vector<int> goalTiles(lengths.size(), -1);
+            std::vector<int> anchors(lengths.size(), -1);
+            // Last tile each tile was found to see, and not to see; walls never move, so both stay valid
+            std::vector<int> visibleTiles(lengths.size(), -1);
+            std::vector<int> hiddenTiles(lengths.size(), -1);
+
+            std::priority_queue<LengthEntry, std::vector<LengthEntry>, std::greater<LengthEntry>> queue;
+            for (const auto& [goalX, goalY] : goals) {
+                const int goalIndex = goalY * width + goalX;
+                lengths[goalIndex] = 0.0;
+                goalTiles[goalIndex] = goalIndex;
+                anchors[goalIndex] = goalIndex;
+                queue.emplace(0.0, goalIndex);
+            }
+
+            auto canSee = [&](int tile, int target) {
+                if (tile == visibleTiles[target]) {
+                    return true;
+                }
+                if (tile == hiddenTiles[target]) {
+                    return false;
+                }
+                const bool visible = hasLineOfSight(walkable, tile % width, tile / width, target % width, target / width);
+                (visible ? visibleTiles : hiddenTiles)[target] = tile;
+                return visible;
+            };
+
+            while (!queue.empty()) {
+                const auto [currentLength, currentIndex] = queue.top();
+                queue.pop();
+                if (currentLength > lengths[currentIndex]) {
+                    continue;
+                }
+
+                const int currentX = currentIndex % width;
+                const int currentY = currentIndex / width;
+                // By the triangle inequality each candidate is at most as long as the next
+                const std::array<int, 3> candidates = {goalTiles[currentIndex], anchors[currentIndex], currentIndex};
+
+                for (const auto& [dx, dy] : directions) {
+                    const int neighborX = currentX + dx;
+                    const int neighborY = currentY + dy;
+                    if (!walkable.get(neighborX, neighborY)) {
+                        continue;
+                    }
+
+                    const int neighborIndex = neighborY * width + neighborX;
+                    for (const int anchor : candidates) {
+                        const double newLength = lengths[anchor] + std::hypot(neighborX - anchor % width, neighborY - anchor / width);
+                        if (newLength >= lengths[neighborIndex]) {
+                            break;
+                        }
+                        // The current tile is checked too, so diagonal steps never cut a wall corner
+                        if (canSee(anchor, neighborIndex)) {
+                            lengths[neighborIndex] = newLength;
+                            goalTiles[neighborIndex] = goalTiles[currentIndex];
+                            anchors[neighborIndex] = anchor;
+                            queue.emplace(newLength, neighborIndex);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            for (int y = 0; y < height; ++y) {
+                int* row = dijkstraMap.getRow(y);
+                for (int x = 0; x < width; ++x) {
+                    const double length = lengths[static_cast<std::size_t>(y) * width + x];
+                    if (length != std::numeric_limits<double>::infinity()) {
+                        row[x] = static_cast<int>(std::round(length));
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Relax one row of a chamfer sweep from the adjacent, already swept row
+         *
+         * Vertical and diagonal steps only read the neighbor row, so this loop has
+         * no dependency between tiles and vectorizes to row-wide min operations.
+         *
+         * @param row Distances of the row being relaxed
+         * @param neighbor Distances of the row above (forward) or below (backward)
+         * @param entryPenalty Per-tile penalty of the row: 0 if walkable, the sweep's infinity otherwise
+         * @param width Number of tiles in the row
+         * @param straightCost Cost of a vertical step
+         * @param diagonalCost Cost of a diagonal step, or 0 for 4-directional movement
+         * @return True if any distance decreased
+         */
+        inline bool relaxSweepRowVertically(int* row,
+                                            const int* neighbor,
+                                            const int* entryPenalty,
+                                            int width,
+                                            int straightCost,
+                                            int diagonalCost)
+        {
+            bool changed = false;
+
+            if (diagonalCost == 0) {
+                for (int x = 0; x < width; ++x) {
+                    const int updated = std::min(row[x], neighbor[x] + straightCost + entryPenalty[x]);
+                    changed |= updated < row[x];
+                    row[x] = updated;
+                }
+                return changed;
+            }
+
+            auto relaxTile = [&](int x, int best) {
+                const int updated = std::min(row[x], best + entryPenalty[x]);
+                changed |= updated < row[x];
+                row[x] = updated;
+            };
+
+            // Interior tiles have both diagonal neighbors; edges are handled separately
+            for (int x = 1; x + 1 < width; ++x) {
+                const int diagonal = std::min(neighbor[x - 1], neighbor[x + 1]) + diagonalCost;
+                relaxTile(x, std::min(neighbor[x] + straightCost, diagonal));
+            }
+            if (width < 2) {
+                if (width == 1) {
+                    relaxTile(0, neighbor[0] + straightCost);
+                }
+                return changed;
+            }
+            relaxTile(0, std::min(neighbor[0] + straightCost, neighbor[1] + diagonalCost));
+            relaxTile(width - 1, std::min(neighbor[width - 1] + straightCost, neighbor[width - 2] + diagonalCost));
+            return changed;
+        }
+
+        /**
+         * @brief Relax one row of a chamfer sweep along the row, left to right then right to left
+         * @param row Distances of the row being relaxed
+         * @param entryPenalty Per-tile penalty of the row: 0 if walkable, the sweep's infinity otherwise
+         * @param width Number of tiles in the row
+         * @param straightCost Cost of a horizontal step
+         * @return True if any distance decreased
+         */
+        inline bool relaxSweepRowHorizontally(int* row, const int* entryPenalty, int width, int straightCost)
+        {
+            bool changed = false;
+            for (int x = 1; x < width; ++x) {
+                const int updated = std::min(row[x], row[x - 1] + straightCost + entryPenalty[x]);
+                changed |= updated < row[x];
+                row[x] = updated;
+            }
+            for (int x = width - 2; x >= 0; --x) {
+                const int updated = std::min(row[x], row[x + 1] + straightCost + entryPenalty[x]);
+                changed |= updated < row[x];
+                row[x] = updated;
+            }
+            return changed;
+        }
+
+        /**
+         * @brief Generate a Dijkstra map by repeated forward and backward raster sweeps
+         *
+         * Each sweep relaxes every row from the previous row, then along the row.
+         * Sweeps repeat until one changes nothing, at which point every tile
+         * satisfies its neighbor constraints and holds the exact flood-fill distance.
+         * Open maps converge in one forward and one backward sweep; every extra
+         * sweep pair follows one more turn of the paths around walls.
+         *
+         * @param dijkstraMap The map to populate with distances
+         * @param goals Goal positions; non-walkable or out-of-bounds goals are ignored
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         */
+        template<typename WalkableFunc>
+        void generateChamferSweep(DijkstraMap& dijkstraMap, const CoordList& goals, WalkableFunc isWalkable)
+        {
+            // Small enough that infinity + penalty + step cost never overflows
+            constexpr int infinity = std::numeric_limits<int>::max() / 4;
+
+            const auto [width, height] = dijkstraMap.getDimensions();
+            const auto& stepCosts = getStepCosts(dijkstraMap.getDistanceType());
+            const int straightCost = stepCosts[0];
+            const int diagonalCost = usesDiagonalMovement(dijkstraMap.getDistanceType()) ? stepCosts[4] : 0;
+
+            std::vector<int> entryPenalty(static_cast<std::size_t>(width) * height);
+            for (int y = 0; y < height; ++y) {
+                int* row = dijkstraMap.getRow(y);
+                int* penaltyRow = entryPenalty.data() + static_cast<std::size_t>(y) * width;
+                for (int x = 0; x < width; ++x) {
+                    penaltyRow[x] = isWalkable(x, y) ? 0 : infinity;
+                    row[x] = infinity;
+                }
+            }
+
+            for (const auto& [goalX, goalY] : goals) {
+                if (dijkstraMap.isWithinBounds(goalX, goalY)
+                    && entryPenalty[static_cast<std::size_t>(goalY) * width + goalX] == 0) {
+                    dijkstraMap.getRow(goalY)[goalX] = 0;
+                }
+            }
+
+            auto penaltyRow = [&entryPenalty, width = width](int y) {
+                return entryPenalty.data() + static_cast<std::size_t>(y) * width;
+            };
+
+            bool changed = true;
+            while (changed) {
+                changed = false;
+
+                for (int y = 0; y < height; ++y) {
+                    int* row = dijkstraMap.getRow(y);
+                    if (y > 0) {
+                        changed |= relaxSweepRowVertically(row, dijkstraMap.getRow(y - 1), penaltyRow(y),
+                                                           width, straightCost, diagonalCost);
+                    }
+                    changed |= relaxSweepRowHorizontally(row, penaltyRow(y), width, straightCost);
+                }
+
+                for (int y = height - 1; y >= 0; --y) {
+                    int* row = dijkstraMap.getRow(y);
+                    if (y + 1 < height) {
+                        changed |= relaxSweepRowVertically(row, dijkstraMap.getRow(y + 1), penaltyRow(y),
+                                                           width, straightCost, diagonalCost);
+                    }
+                    changed |= relaxSweepRowHorizontally(row, penaltyRow(y), width, straightCost);
+                }
+            }
+
+            for (int y = 0; y < height; ++y) {
+                int* row = dijkstraMap.getRow(y);
+                for (int x = 0; x < width; ++x) {
+                    row[x] = (row[x] >= infinity) ? DijkstraMap::UNREACHABLE : row[x];
+                }
+            }
+        }
+
+        /**
+         * @brief Count the walkable neighbors of a tile
+         * @param x X coordinate
+         * @param y Y coordinate
+         * @param width Width of the map
+         * @param height Height of the map
+         * @param directions Movement directions
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         * @return Number of in-bounds walkable neighbors
+         */
+        template<typename WalkableFunc>
+        int countWalkableNeighbors(int x,
+                                   int y,
+                                   int width,
+                                   int height,
+                                   const std::vector<std::tuple<int, int>>& directions,
+                                   WalkableFunc isWalkable)
+        {
+            int count = 0;
+            for (const auto& [dx, dy] : directions) {
+                const int neighborX = x + dx;
+                const int neighborY = y + dy;
+                if (neighborX >= 0 && neighborX < width && neighborY >= 0 && neighborY < height
+                    && isWalkable(neighborX, neighborY)) {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Trace the chain that leaves a node through one of its corridor neighbors
+         * @param graph Graph to add the chain to
+         * @param startNode Node the chain starts at
+         * @param firstX X coordinate of the first corridor tile, adjacent to the node
+         * @param firstY Y coordinate of the first corridor tile, adjacent to the node
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         */
+        template<typename WalkableFunc>
+        void traceCorridorChain(CorridorGraph& graph,
+                                int startNode,
+                                int firstX,
+                                int firstY,
+                                WalkableFunc isWalkable)
+        {
+            const auto [width, height] = graph.getDimensions();
+            const auto& directions = getDirections(graph.getDistanceType());
+            const auto& stepCosts = getStepCosts(graph.getDistanceType());
+            const int directionCount = static_cast<int>(directions.size());
+
+            CorridorGraph::Chain chain;
+            chain.firstNode = startNode;
+            chain.lastNode = startNode;
+
+            auto [previousX, previousY] = graph.getNode(startNode);
+            int currentX = firstX;
+            int currentY = firstY;
+            int length = 0;
+
+            // Cost of the step between two adjacent tiles
+            auto stepCost = [&](int fromX, int fromY, int toX, int toY) {
+                for (int direction = 0; direction < directionCount; ++direction) {
+                    const auto [dx, dy] = directions[direction];
+                    if (fromX + dx == toX && fromY + dy == toY) {
+                        return stepCosts[direction];
+                    }
+                }
+                return 0;
+            };
+
+            length += stepCost(previousX, previousY, currentX, currentY);
+            while (true) {
+                chain.tiles.push_back(currentY * width + currentX);
+                chain.offsets.push_back(length);
+
+                // A corridor tile has exactly one walkable neighbor besides the one we came from
+                int nextX = currentX;
+                int nextY = currentY;
+                int nextCost = 0;
+                for (int direction = 0; direction < directionCount; ++direction) {
+                    const auto [dx, dy] = directions[direction];
+                    const int neighborX = currentX + dx;
+                    const int neighborY = currentY + dy;
+                    if ((neighborX == previousX && neighborY == previousY)
+                        || neighborX < 0 || neighborX >= width || neighborY < 0 || neighborY >= height
+                        || !isWalkable(neighborX, neighborY)) {
+                        continue;
+                    }
+                    nextX = neighborX;
+                    nextY = neighborY;
+                    nextCost = stepCosts[direction];
+                    break;
+                }
+
+                length += nextCost;
+                const int nextNode = graph.getNodeId(nextX, nextY);
+                if (nextNode != CorridorGraph::NO_NODE) {
+                    chain.lastNode = nextNode;
+                    break;
+                }
+
+                previousX = currentX;
+                previousY = currentY;
+                currentX = nextX;
+                currentY = nextY;
+            }
+
+            chain.length = length;
+            graph.addChain(std::move(chain));
+        }
+
+        /**
+         * @brief Put a corridor tile that is not in a chain back into one
+         *
+         * Walks along the corridor until a tile next to a node is found and traces
+         * the chain from there. A corridor loop without any node gets the starting
+         * tile promoted to a node.
+         *
+         * @param graph Graph to add the chain to
+         * @param x X coordinate of the tile
+         * @param y Y coordinate of the tile
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         */
+        template<typename WalkableFunc>
+        void traceLooseCorridorTile(CorridorGraph& graph, int x, int y, WalkableFunc isWalkable)
+        {
+            if (!isWalkable(x, y) || graph.getNodeId(x, y) != CorridorGraph::NO_NODE
+                || graph.getChainId(x, y) != CorridorGraph::NO_CHAIN) {
+                return;
+            }
+
+            const auto [width, height] = graph.getDimensions();
+            const auto& directions = getDirections(graph.getDistanceType());
+
+            auto walkableNeighbors = [&](int tileX, int tileY) {
+                CoordList neighbors;
+                for (const auto& [dx, dy] : directions) {
+                    const int neighborX = tileX + dx;
+                    const int neighborY = tileY + dy;
+                    if (neighborX >= 0 && neighborX < width && neighborY >= 0 && neighborY < height
+                        && isWalkable(neighborX, neighborY)) {
+                        neighbors.emplace_back(neighborX, neighborY);
+                    }
+                }
+                return neighbors;
+            };
+
+            int previousX = -1;
+            int previousY = -1;
+            int currentX = x;
+            int currentY = y;
+            while (true) {
+                const CoordList neighbors = walkableNeighbors(currentX, currentY);
+                for (const auto& [neighborX, neighborY] : neighbors) {
+                    const int nodeId = graph.getNodeId(neighborX, neighborY);
+                    if (nodeId != CorridorGraph::NO_NODE) {
+                        traceCorridorChain(graph, nodeId, currentX, currentY, isWalkable);
+                        return;
+                    }
+                }
+
+                const auto [firstX, firstY] = neighbors[0];
+                const bool cameFromFirst = firstX == previousX && firstY == previousY;
+                const auto [nextX, nextY] = cameFromFirst ? neighbors[1] : neighbors[0];
+                if (nextX == x && nextY == y) {
+                    // Closed corridor loop: anchor it with a node
+                    const int nodeId = graph.addNode(x, y);
+                    traceCorridorChain(graph, nodeId, currentX, currentY, isWalkable);
+                    return;
+                }
+
+                previousX = currentX;
+                previousY = currentY;
+                currentX = nextX;
+                currentY = nextY;
+            }
+        }
+
+        /**
+         * @brief Pick crossings along one chunk border
+         *
+         * Every run of open border positions gets one crossing in its middle, or
+         * one at each end if it is at least six tiles long.
+         *
+         * @param length Number of positions along the border
+         * @param isOpen Function checking a position: bool(int position)
+         * @param makeCrossing Function building the crossing of a position: Crossing(int position)
+         * @return Crossings of the border
+         */
+        template<typename OpenFunc, typename CrossingFunc>
+        std::vector<ChunkHierarchy::Crossing> pickBorderCrossings(int length, OpenFunc isOpen, CrossingFunc makeCrossing)
+        {
+            constexpr int longRunLength = 6;
+            std::vector<ChunkHierarchy::Crossing> crossings;
+
+            int position = 0;
+            while (position < length) {
+                if (!isOpen(position)) {
+                    ++position;
+                    continue;
+                }
+
+                const int runBegin = position;
+                while (position < length && isOpen(position)) {
+                    ++position;
+                }
+                const int runLast = position - 1;
+
+                if (runLast - runBegin + 1 >= longRunLength) {
+                    crossings.push_back(makeCrossing(runBegin));
+                    crossings.push_back(makeCrossing(runLast));
+                } else {
+                    crossings.push_back(makeCrossing((runBegin + runLast) / 2));
+                }
+            }
+            return crossings;
+        }
+
+        /**
+         * @brief Check whether two diagonally adjacent tiles are joined only by their diagonal step
+         *
+         * If either tile between them is walkable, the orthogonal crossings of
+         * the borders already connect the two tiles' chunks.
+         *
+         * @param x X coordinate of the first tile
+         * @param y Y coordinate of the first tile
+         * @param otherX X coordinate of the second tile
+         * @param otherY Y coordinate of the second tile
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         * @return True if both tiles are walkable and both tiles between them are walls
+         */
+        template<typename WalkableFunc>
+        bool isDiagonalOnlyStep(int x, int y, int otherX, int otherY, WalkableFunc isWalkable)
+        {
+            return isWalkable(x, y) && isWalkable(otherX, otherY) && !isWalkable(otherX, y) && !isWalkable(x, otherY);
+        }
+
+        /**
+         * @brief Recompute the crossings on the east and south borders and the southern corners of a chunk
+         *
+         * With diagonal movement, diagonal steps that no orthogonal crossing
+         * can replace get crossings of their own: along the east and south
+         * borders, and at the southeast and southwest corners into the chunks
+         * diagonally below.
+         *
+         * @param hierarchy Hierarchy to update
+         * @param chunkX Chunk column
+         * @param chunkY Chunk row
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         */
+        template<typename WalkableFunc>
+        void updateChunkCrossings(ChunkHierarchy& hierarchy, int chunkX, int chunkY, WalkableFunc isWalkable)
+        {
+            using Crossing = ChunkHierarchy::Crossing;
+            const auto [chunksX, chunksY] = hierarchy.getChunkCounts();
+            const auto [x0, y0, chunkWidth, chunkHeight] = hierarchy.getChunkBounds(chunkX, chunkY);
+            const bool diagonal = usesDiagonalMovement(hierarchy.getDistanceType());
+            const int x = x0 + chunkWidth - 1;
+            const int y = y0 + chunkHeight - 1;
+
+            std::vector<Crossing> east;
+            if (chunkX + 1 < chunksX) {
+                east = pickBorderCrossings(chunkHeight,
+                    [&](int position) { return isWalkable(x, y0 + position) && isWalkable(x + 1, y0 + position); },
+                    [&](int position) { return Crossing{x, y0 + position, x + 1, y0 + position}; });
+
+                if (diagonal) {
+                    for (int position = 0; position + 1 < chunkHeight; ++position) {
+                        const int top = y0 + position;
+                        if (isDiagonalOnlyStep(x, top, x + 1, top + 1, isWalkable)) {
+                            east.push_back({x, top, x + 1, top + 1});
+                        } else if (isDiagonalOnlyStep(x, top + 1, x + 1, top, isWalkable)) {
+                            east.push_back({x, top + 1, x + 1, top});
+                        }
+                    }
+                }
+            }
+
+            std::vector<Crossing> south;
+            if (chunkY + 1 < chunksY) {
+                south = pickBorderCrossings(chunkWidth,
+                    [&](int position) { return isWalkable(x0 + position, y) && isWalkable(x0 + position, y + 1); },
+                    [&](int position) { return Crossing{x0 + position, y, x0 + position, y + 1}; });
+
+                if (diagonal) {
+                    for (int position = 0; position + 1 < chunkWidth; ++position) {
+                        const int left = x0 + position;
+                        if (isDiagonalOnlyStep(left, y, left + 1, y + 1, isWalkable)) {
+                            south.push_back({left, y, left + 1, y + 1});
+                        } else if (isDiagonalOnlyStep(left + 1, y, left, y + 1, isWalkable)) {
+                            south.push_back({left + 1, y, left, y + 1});
+                        }
+                    }
+                }
+            }
+
+            std::vector<Crossing> southEast;
+            std::vector<Crossing> southWest;
+            if (diagonal && chunkY + 1 < chunksY) {
+                if (chunkX + 1 < chunksX && isDiagonalOnlyStep(x, y, x + 1, y + 1, isWalkable)) {
+                    southEast.push_back({x, y, x + 1, y + 1});
+                }
+                if (chunkX > 0 && isDiagonalOnlyStep(x0, y, x0 - 1, y + 1, isWalkable)) {
+                    southWest.push_back({x0, y, x0 - 1, y + 1});
+                }
+            }
+
+            hierarchy.setEastCrossings(chunkX, chunkY, std::move(east));
+            hierarchy.setSouthCrossings(chunkX, chunkY, std::move(south));
+            hierarchy.setSouthEastCrossings(chunkX, chunkY, std::move(southEast));
+            hierarchy.setSouthWestCrossings(chunkX, chunkY, std::move(southWest));
+        }
+
+        /**
+         * @brief Flood fill a chunk from seeded tiles, never leaving the chunk
+         * @param hierarchy Hierarchy providing the chunk bounds and distance type
+         * @param chunkX Chunk column
+         * @param chunkY Chunk row
+         * @param seeds Seeds as (distance, x, y) in map coordinates
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         * @return Chunk-sized map of distances, in chunk-local coordinates
+         */
+        template<typename WalkableFunc>
+        DijkstraMap fillChunk(const ChunkHierarchy& hierarchy,
+                              int chunkX,
+                              int chunkY,
+                              const std::vector<QueueEntry>& seeds,
+                              WalkableFunc isWalkable)
+        {
+            const auto [x0, y0, chunkWidth, chunkHeight] = hierarchy.getChunkBounds(chunkX, chunkY);
+            DijkstraMap local(chunkWidth, chunkHeight, hierarchy.getDistanceType());
+
+            auto isLocalWalkable = [&, x0 = x0, y0 = y0](int x, int y) {
+                return isWalkable(x0 + x, y0 + y);
+            };
+
+            PriorityQueue queue;
+            for (const auto& [distance, x, y] : seeds) {
+                const int localX = x - x0;
+                const int localY = y - y0;
+                if (local.isWithinBounds(localX, localY) && isLocalWalkable(localX, localY)
+                    && distance < local.getDistance(localX, localY)) {
+                    local.setDistance(localX, localY, distance);
+                    queue.push({distance, localX, localY});
+                }
+            }
+
+            propagateDistances(local, isLocalWalkable, queue);
+            return local;
+        }
+
+        /**
+         * @brief Recompute the in-chunk distances between the entrances of a chunk
+         * @param hierarchy Hierarchy to update
+         * @param chunkX Chunk column
+         * @param chunkY Chunk row
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         */
+        template<typename WalkableFunc>
+        void updateChunkDistanceTable(ChunkHierarchy& hierarchy, int chunkX, int chunkY, WalkableFunc isWalkable)
+        {
+            const auto [x0, y0, chunkWidth, chunkHeight] = hierarchy.getChunkBounds(chunkX, chunkY);
+            const auto entrances = hierarchy.getEntrances(chunkX, chunkY);
+            const int entranceCount = static_cast<int>(entrances.size());
+
+            std::vector<int> table(static_cast<std::size_t>(entranceCount) * entranceCount, DijkstraMap::UNREACHABLE);
+            for (int from = 0; from < entranceCount; ++from) {
+                const auto [fromX, fromY] = entrances[from];
+                const DijkstraMap local = fillChunk(hierarchy, chunkX, chunkY, {{0, fromX, fromY}}, isWalkable);
+                for (int to = 0; to < entranceCount; ++to) {
+                    const auto [toX, toY] = entrances[to];
+                    table[static_cast<std::size_t>(from) * entranceCount + to] = local.getDistance(toX - x0, toY - y0);
+                }
+            }
+
+            hierarchy.setDistanceTable(chunkX, chunkY, std::move(table));
+        }
+
+        /**
+         * @brief Settle the tiles of a seeded search workspace in key order
+         *
+         * Lazy-deletion Dijkstra, or A* with a heuristic: each popped tile is
+         * visited once with its final distance, then its neighbors are relaxed.
+         *
+         * @param workspace Scratch storage holding the seeded start tiles
+         * @param isWalkable Function to check walkability in workspace coordinates: bool(int x, int y)
+         * @param distType Distance type deciding directions and step costs
+         * @param maxDistance Largest distance to reach
+         * @param heuristic Admissible estimate added to the queue key: int(int x, int y)
+         * @param visit Function called for each settled tile, returns false to stop: bool(int x, int y, int distance)
+         * @return Distance of the tile the search stopped at, or UNREACHABLE if the queue ran out
+         */
+        template<typename WalkableFunc, typename HeuristicFunc, typename VisitFunc>
+        int settleWorkspace(SearchWorkspace& workspace,
+                            WalkableFunc isWalkable,
+                            DistanceType distType,
+                            int maxDistance,
+                            HeuristicFunc heuristic,
+                            VisitFunc visit)
+        {
+            const auto& directions = getDirections(distType);
+            const auto& stepCosts = getStepCosts(distType);
+            const int directionCount = static_cast<int>(directions.size());
+            const int width = std::get<0>(workspace.getDimensions());
+
+            while (!workspace.empty()) {
+                const auto [key, currentX, currentY] = workspace.pop();
+                const int currentDist = workspace.getDistance(currentX, currentY);
+
+                // Skip entries pushed before a shorter path to this tile was found
+                if (key > currentDist + heuristic(currentX, currentY)) {
+                    continue;
+                }
+                workspace.countExpansion();
+
+                if (!visit(currentX, currentY, currentDist)) {
+                    return currentDist;
+                }
+
+                const int currentIndex = currentY * width + currentX;
+                for (int direction = 0; direction < directionCount; ++direction) {
+                    const auto [dx, dy] = directions[direction];
+                    const int neighborX = currentX + dx;
+                    const int neighborY = currentY + dy;
+
+                    if (!workspace.isWithinBounds(neighborX, neighborY) || !isWalkable(neighborX, neighborY)) {
+                        continue;
+                    }
+
+                    const int newDistance = currentDist + stepCosts[direction];
+                    if (newDistance > maxDistance || newDistance >= workspace.getDistance(neighborX, neighborY)) {
+                        continue;
+                    }
+
+                    workspace.setDistance(neighborX, neighborY, newDistance, currentIndex);
+                    workspace.push(newDistance + heuristic(neighborX, neighborY), neighborX, neighborY);
+                }
+            }
+
+            return DijkstraMap::UNREACHABLE;
+        }
+
+        /**
+         * @brief Run A* from start to goal over a search workspace
+         *
+         * Stops as soon as the goal is expanded, so only tiles whose estimated
+         * total cost is below the path length are visited. With a consistent
+         * heuristic every tile is expanded at most once.
+         *
+         * @param workspace Scratch storage, reset by this call; keeps the parents afterwards
+         * @param start Start position
+         * @param goal Goal position
+         * @param isWalkable Function to check walkability
+         * @param distType Distance type deciding directions and step costs
+         * @param heuristic Admissible estimate of the remaining distance: int(int x, int y)
+         * @return Distance from start to goal, or UNREACHABLE
+         */
+        template<typename WalkableFunc, typename HeuristicFunc>
+        int searchPath(SearchWorkspace& workspace,
+                       const Coord& start,
+                       const Coord& goal,
+                       WalkableFunc isWalkable,
+                       DistanceType distType,
+                       HeuristicFunc heuristic)
+        {
+            workspace.reset();
+
+            const auto [startX, startY] = start;
+            const auto [goalX, goalY] = goal;
+            if (!workspace.isWithinBounds(startX, startY) || !isWalkable(startX, startY) ||
+                !workspace.isWithinBounds(goalX, goalY) || !isWalkable(goalX, goalY)) {
+                return DijkstraMap::UNREACHABLE;
+            }
+
+            workspace.setDistance(startX, startY, 0, SearchWorkspace::NO_PARENT);
+            workspace.push(heuristic(startX, startY), startX, startY);
+
+            return settleWorkspace(workspace, isWalkable, distType, std::numeric_limits<int>::max(), heuristic,
+                                   [&](int x, int y, int) {
+                                       return x != goalX || y != goalY;
+                                   });
+        }
+
+        /**
+         * @brief Walk the parents left by searchPath back from the goal
+         * @param workspace Workspace of a search that reached the goal
+         * @param goal Goal position
+         * @return Positions from start to goal, both included
+         */
+        inline CoordList reconstructPath(const SearchWorkspace& workspace, const Coord& goal)
+        {
+            const auto [width, height] = workspace.getDimensions();
+
+            CoordList path;
+            auto [x, y] = goal;
+            while (true) {
+                path.emplace_back(x, y);
+                const int parentIndex = workspace.getParentIndex(x, y);
+                if (parentIndex == SearchWorkspace::NO_PARENT) {
+                    break;
+                }
+                x = parentIndex % width;
+                y = parentIndex / width;
+            }
+
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+        /**
+         * @brief Get the position of the lowest set bit of a word
+         * @param word Word to inspect, must not be zero
+         * @return Bit position
+         */
+        inline int lowestSetBit(BitGrid::Word word)
+        {
+            return BitGrid::countBits((word & (~word + 1)) - 1);
+        }
+
+        /**
+         * @brief Get the position of the highest set bit of a word
+         * @param word Word to inspect, must not be zero
+         * @return Bit position
+         */
+        inline int highestSetBit(BitGrid::Word word)
+        {
+            for (int shift = 1; shift < BitGrid::BITS_PER_WORD; shift *= 2) {
+                word |= word >> shift;
+            }
+            return BitGrid::countBits(word) - 1;
+        }
+
+        /**
+         * @brief Scan a line of a bit grid for the next jump point, a word at a time
+         *
+         * A tile is a jump point when a side tile next to it is blocked while the
+         * tile one step further along that side is open: the only way to make that
+         * turn optimally is from here.
+         *
+         * @param lines Grid whose rows are the lines to scan (JumpPointGrid rows or columns)
+         * @param line Line to scan
+         * @param from First position to test
+         * @param step Scan direction, +1 or -1
+         * @param goalPosition Position of the goal on this line, or -1 if it lies elsewhere
+         * @return Position of the first jump point or the goal, or -1 if a wall or the edge comes first
+         */
+        inline int scanLineForJumpPoint(const BitGrid& lines, int line, int from, int step, int goalPosition)
+        {
+            using Word = BitGrid::Word;
+            constexpr int bits = BitGrid::BITS_PER_WORD;
+
+            const auto [lineLength, lineCount] = lines.getDimensions();
+            if (from < 0 || from >= lineLength) {
+                return -1;
+            }
+
+            const int wordCount = lines.getWordsPerRow();
+            const Word* current = lines.getRow(line);
+            const Word* before = (line > 0) ? lines.getRow(line - 1) : nullptr;
+            const Word* after = (line + 1 < lineCount) ? lines.getRow(line + 1) : nullptr;
+
+            // Missing lines and words past either end read as walls
+            auto wordAt = [wordCount](const Word* side, int word) {
+                return (side != nullptr && word >= 0 && word < wordCount) ? side[word] : Word{0};
+            };
+            // Side line shifted so that bit p holds position p + step
+            auto ahead = [&](const Word* side, int word) {
+                return (step > 0)
+                    ? (wordAt(side, word) >> 1) | (wordAt(side, word + 1) << (bits - 1))
+                    : (wordAt(side, word) << 1) | (wordAt(side, word - 1) >> (bits - 1));
+            };
+
+            for (int word = from / bits; word >= 0 && word < wordCount; word += step) {
+                const Word forced = (~wordAt(before, word) & ahead(before, word)) |
+                                    (~wordAt(after, word) & ahead(after, word));
+                Word events = ~current[word] | forced;
+                if (goalPosition >= 0 && goalPosition / bits == word) {
+                    events |= Word{1} << (goalPosition % bits);
+                }
+                if (word == from / bits) {
+                    const int offset = from % bits;
+                    events &= (step > 0) ? (~Word{0} << offset) : (~Word{0} >> (bits - 1 - offset));
+                }
+
+                if (events != 0) {
+                    const int bit = (step > 0) ? lowestSetBit(events) : highestSetBit(events);
+                    const int position = word * bits + bit;
+                    if (position == goalPosition) {
+                        return position;
+                    }
+                    return ((current[word] >> bit) & 1) ? position : -1;
+                }
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Jump horizontally or vertically from a tile
+         * @param grid Walkability grid
+         * @param x Start X coordinate
+         * @param y Start Y coordinate
+         * @param dx Direction X offset, 0 for vertical jumps
+         * @param dy Direction Y offset, 0 for horizontal jumps
+         * @param goalX Goal X coordinate
+         * @param goalY Goal Y coordinate
+         * @return Row-major index of the jump point, or -1 if there is none
+         */
+        inline int jumpStraight(const JumpPointGrid& grid, int x, int y, int dx, int dy, int goalX, int goalY)
+        {
+            const auto [width, height] = grid.getDimensions();
+
+            if (dy == 0) {
+                const int jumpX = scanLineForJumpPoint(grid.getRows(), y, x + dx, dx, (goalY == y) ? goalX : -1);
+                return (jumpX < 0) ? -1 : y * width + jumpX;
+            }
+            const int jumpY = scanLineForJumpPoint(grid.getColumns(), x, y + dy, dy, (goalX == x) ? goalY : -1);
+            return (jumpY < 0) ? -1 : jumpY * width + x;
+        }
+
+        /**
+         * @brief Jump diagonally from a tile
+         *
+         * Stops on the goal, on a tile with a forced neighbor, or on a tile from
+         * which one of the two straight jumps along the diagonal finds something.
+         *
+         * @param grid Walkability grid
+         * @param x Start X coordinate
+         * @param y Start Y coordinate
+         * @param dx Direction X offset
+         * @param dy Direction Y offset
+         * @param goalX Goal X coordinate
+         * @param goalY Goal Y coordinate
+         * @return Row-major index of the jump point, or -1 if there is none
+         */
+        inline int jumpDiagonally(const JumpPointGrid& grid, int x, int y, int dx, int dy, int goalX, int goalY)
+        {
+            const auto [width, height] = grid.getDimensions();
+
+            while (true) {
+                x += dx;
+                y += dy;
+                if (!grid.isWalkable(x, y)) {
+                    return -1;
+                }
+
+                const bool isJumpPoint = (x == goalX && y == goalY) ||
+                    (!grid.isWalkable(x - dx, y) && grid.isWalkable(x - dx, y + dy)) ||
+                    (!grid.isWalkable(x, y - dy) && grid.isWalkable(x + dx, y - dy)) ||
+                    jumpStraight(grid, x, y, dx, 0, goalX, goalY) >= 0 ||
+                    jumpStraight(grid, x, y, 0, dy, goalX, goalY) >= 0;
+                if (isJumpPoint) {
+                    return y * width + x;
+                }
+            }
+        }
+
+        /**
+         * @brief Run jump point search from start to goal
+         *
+         * A* over jump points only: straight and diagonal runs without forced
+         * neighbors are skipped in one jump. Needs a distance type that moves
+         * diagonally; every step of one direction costs the same.
+         *
+         * @param workspace Scratch storage, reset by this call, or replaced if sized for another map;
+         *                  keeps the jump point parents afterwards
+         * @param grid Walkability grid
+         * @param start Start position
+         * @param goal Goal position
+         * @return Distance from start to goal, or UNREACHABLE
+         */
+        inline int searchJumpPoints(SearchWorkspace& workspace,
+                                    const JumpPointGrid& grid,
+                                    const Coord& start,
+                                    const Coord& goal)
+        {
+            // Jumps only check the grid's bounds, so the workspace must cover the same tiles
+            const auto [width, height] = grid.getDimensions();
+            if (workspace.getDimensions() != grid.getDimensions()) {
+                workspace = SearchWorkspace(width, height);
+            } else {
+                workspace.reset();
+            }
+
+            const auto [startX, startY] = start;
+            const auto [goalX, goalY] = goal;
+            if (!grid.isWalkable(startX, startY) || !grid.isWalkable(goalX, goalY)) {
+                return DijkstraMap::UNREACHABLE;
+            }
+
+            const auto& stepCosts = getStepCosts(grid.getDistanceType());
+            const int straightCost = stepCosts[0];
+            const int diagonalCost = stepCosts[4];
+            // Zero-sized map used only for its distance calculation
+            const DijkstraMap metric(0, 0, grid.getDistanceType());
+
+            workspace.setDistance(startX, startY, 0, SearchWorkspace::NO_PARENT);
+            workspace.push(metric.calculateDistance(startX, startY, goalX, goalY), startX, startY);
+
+            while (!workspace.empty()) {
+                const auto [estimate, currentX, currentY] = workspace.pop();
+                const int currentDist = workspace.getDistance(currentX, currentY);
+
+                if (estimate > currentDist + metric.calculateDistance(currentX, currentY, goalX, goalY)) {
+                    continue;
+                }
+                workspace.countExpansion();
+
+                if (currentX == goalX && currentY == goalY) {
+                    return currentDist;
+                }
+
+                // Directions not covered by a path that skips this tile
+                std::array<Coord, 8> searchDirections;
+                int directionCount = 0;
+                const int parentIndex = workspace.getParentIndex(currentX, currentY);
+                if (parentIndex == SearchWorkspace::NO_PARENT) {
+                    for (const Coord& direction : getDirections(grid.getDistanceType())) {
+                        searchDirections[directionCount++] = direction;
+                    }
+                } else {
+                    const int dx = (currentX > parentIndex % width) - (currentX < parentIndex % width);
+                    const int dy = (currentY > parentIndex / width) - (currentY < parentIndex / width);
+                    if (dx != 0 && dy != 0) {
+                        searchDirections[directionCount++] = {dx, 0};
+                        searchDirections[directionCount++] = {0, dy};
+                        searchDirections[directionCount++] = {dx, dy};
+                        if (!grid.isWalkable(currentX - dx, currentY)) {
+                            searchDirections[directionCount++] = {-dx, dy};
+                        }
+                        if (!grid.isWalkable(currentX, currentY - dy)) {
+                            searchDirections[directionCount++] = {dx, -dy};
+                        }
+                    } else {
+                        searchDirections[directionCount++] = {dx, dy};
+                        for (const int side : {-1, 1}) {
+                            if (!grid.isWalkable(currentX + side * dy, currentY + side * dx)) {
+                                searchDirections[directionCount++] = {dx + side * dy, dy + side * dx};
+                            }
+                        }
+                    }
+                }
+
+                const int currentIndex = currentY * width + currentX;
+                for (int direction = 0; direction < directionCount; ++direction) {
+                    const auto [dx, dy] = searchDirections[direction];
+                    const bool diagonal = dx != 0 && dy != 0;
+                    const int jumpIndex = diagonal
+                        ? jumpDiagonally(grid, currentX, currentY, dx, dy, goalX, goalY)
+                        : jumpStraight(grid, currentX, currentY, dx, dy, goalX, goalY);
+                    if (jumpIndex < 0) {
+                        continue;
+                    }
+
+                    const int jumpX = jumpIndex % width;
+                    const int jumpY = jumpIndex / width;
+                    const int steps = std::max(std::abs(jumpX - currentX), std::abs(jumpY - currentY));
+                    const int newDistance = currentDist + steps * (diagonal ? diagonalCost : straightCost);
+                    if (newDistance >= workspace.getDistance(jumpX, jumpY)) {
+                        continue;
+                    }
+
+                    workspace.setDistance(jumpX, jumpY, newDistance, currentIndex);
+                    workspace.push(newDistance + metric.calculateDistance(jumpX, jumpY, goalX, goalY), jumpX, jumpY);
+                }
+            }
+
+            return DijkstraMap::UNREACHABLE;
+        }
+
+        /**
+         * @brief Fill in the tiles between consecutive jump points
+         * @param jumpPoints Jump points from start to goal, each a straight or diagonal run from the last
+         * @return Every tile from start to goal
+         */
+        inline CoordList expandJumpPoints(const CoordList& jumpPoints)
+        {
+            CoordList path;
+            if (jumpPoints.empty()) {
+                return path;
+            }
+
+            path.push_back(jumpPoints.front());
+            for (std::size_t i = 1; i < jumpPoints.size(); ++i) {
+                auto [x, y] = jumpPoints[i - 1];
+                const auto [toX, toY] = jumpPoints[i];
+                const int dx = (toX > x) - (toX < x);
+                const int dy = (toY > y) - (toY < y);
+                while (x != toX || y != toY) {
+                    x += dx;
+                    y += dy;
+                    path.emplace_back(x, y);
+                }
+            }
+            return path;
+        }
+
+        /**
+         * @brief Run Dijkstra from both ends of a query until the frontiers meet
+         *
+         * The forward search from source pays the cost of each tile it enters;
+         * the backward search from target pays the cost of each tile it leaves,
+         * so both measure the same edges. The sides take turns expanding a tile.
+         * Every edge that reaches a tile labeled by the other side proposes a
+         * meeting distance; once the two smallest open keys add up to at least
+         * the best proposal, no shorter path is left.
+         *
+         * @param forward Scratch storage of the search from source, reset by this call
+         * @param backward Scratch storage of the search from target, reset by this call
+         * @param source Tile the path starts from, distance 0
+         * @param target Tile the path ends at
+         * @param tileCost Function returning the cost to enter a tile, negative if impassable: int(int x, int y)
+         * @param distType Distance type deciding directions and step costs
+         * @return Distance from source to target, or UNREACHABLE
+         */
+        template<typename CostFunc>
+        int searchBidirectional(SearchWorkspace& forward,
+                                SearchWorkspace& backward,
+                                const Coord& source,
+                                const Coord& target,
+                                CostFunc tileCost,
+                                DistanceType distType)
+        {
+            forward.reset();
+            backward.reset();
+
+            const auto [sourceX, sourceY] = source;
+            const auto [targetX, targetY] = target;
+            if (!forward.isWithinBounds(sourceX, sourceY) || tileCost(sourceX, sourceY) < 0 ||
+                !forward.isWithinBounds(targetX, targetY) || tileCost(targetX, targetY) < 0) {
+                return DijkstraMap::UNREACHABLE;
+            }
+            if (source == target) {
+                return 0;
+            }
+
+            const auto& directions = getDirections(distType);
+            const auto& stepCosts = getStepCosts(distType);
+            const int directionCount = static_cast<int>(directions.size());
+            const auto [width, height] = forward.getDimensions();
+
+            forward.setDistance(sourceX, sourceY, 0, SearchWorkspace::NO_PARENT);
+            forward.push(0, sourceX, sourceY);
+            backward.setDistance(targetX, targetY, 0, SearchWorkspace::NO_PARENT);
+            backward.push(0, targetX, targetY);
+
+            int best = DijkstraMap::UNREACHABLE;
+            bool forwardTurn = true;
+            while (!forward.empty() && !backward.empty()) {
+                const auto [forwardKey, forwardX, forwardY] = forward.top();
+                const auto [backwardKey, backwardX, backwardY] = backward.top();
+                if (best != DijkstraMap::UNREACHABLE && forwardKey + backwardKey >= best) {
+                    break;
+                }
+
+                SearchWorkspace& side = forwardTurn ? forward : backward;
+                const SearchWorkspace& other = forwardTurn ? backward : forward;
+                const auto [currentDist, currentX, currentY] = side.pop();
+                const bool wasForwardTurn = forwardTurn;
+                forwardTurn = !forwardTurn;
+
+                // Skip if we've already found a better path to this tile
+                if (currentDist > side.getDistance(currentX, currentY)) {
+                    continue;
+                }
+                side.countExpansion();
+
+                const int currentCost = tileCost(currentX, currentY);
+                const int currentIndex = currentY * width + currentX;
+                for (int direction = 0; direction < directionCount; ++direction) {
+                    const auto [dx, dy] = directions[direction];
+                    const int neighborX = currentX + dx;
+                    const int neighborY = currentY + dy;
+                    if (!side.isWithinBounds(neighborX, neighborY)) {
+                        continue;
+                    }
+
+                    const int neighborCost = tileCost(neighborX, neighborY);
+                    if (neighborCost < 0) {
+                        continue;
+                    }
+
+                    const int newDistance = currentDist + stepCosts[direction] * (wasForwardTurn ? neighborCost : currentCost);
+                    const int otherDistance = other.getDistance(neighborX, neighborY);
+                    if (otherDistance != DijkstraMap::UNREACHABLE) {
+                        best = std::min(best, newDistance + otherDistance);
+                    }
+
+                    if (newDistance < side.getDistance(neighborX, neighborY)) {
+                        side.setDistance(neighborX, neighborY, newDistance, currentIndex);
+                        side.push(newDistance, neighborX, neighborY);
+                    }
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Resolve a requested thread count
+         * @param threadCount Requested threads, 0 for one per hardware thread
+         * @return Threads to use, at least 1
+         */
+        inline int resolveThreadCount(int threadCount)
+        {
+            if (threadCount > 0) {
+                return threadCount;
+            }
+            return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+
+        /**
+         * @brief Call a function for every item in [0, count) on several threads
+         *
+         * Threads take items from a shared counter, so items of uneven cost
+         * balance out. The calling thread works as thread 0.
+         *
+         * @param count Number of items
+         * @param threadCount Threads to use, at least 1
+         * @param work Function called once per item: void(int item, int thread)
+         */
+        template<typename WorkFunc>
+        void parallelFor(int count, int threadCount, WorkFunc work)
+        {
+            std::atomic<int> nextItem{0};
+            auto run = [&](int thread) {
+                for (int item = nextItem++; item < count; item = nextItem++) {
+                    work(item, thread);
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (int thread = 1; thread < std::min(threadCount, count); ++thread) {
+                threads.emplace_back(run, thread);
+            }
+            run(0);
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief Walkability packed into a bit grid, for work spread over threads
+         *
+         * Reading the grid is safe from every thread, unlike isWalkable, which
+         * is then only called while building it on the calling thread.
+         */
+        class SharedWalkability
+        {
+            BitGrid grid;
+
+        public:
+            /**
+             * @brief Constructor - takes over a packed walkability grid
+             * @param walkable Grid built with buildWalkabilityGrid
+             */
+            explicit SharedWalkability(BitGrid walkable)
+                : grid(std::move(walkable))
+            {
+            }
+
+            /**
+             * @brief Get the packed walkability grid
+             * @return Grid with one set bit per walkable tile
+             */
+            const BitGrid& getGrid() const
+            {
+                return grid;
+            }
+
+            /**
+             * @brief Get a walkability function reading the grid
+             * @return Function cheap to copy into each thread's work: bool(int x, int y); must not outlive this object
+             */
+            auto getWalkableFunc() const
+            {
+                return [this](int x, int y) {
+                    return grid.get(x, y);
+                };
+            }
+        };
+
+        /**
+         * @brief Edge of the remaining graph while building a contraction hierarchy
+         */
+        struct ContractionArc
+        {
+            int node;
+            int weight;
+            int middle;  // Contracted node a shortcut replaces, or ContractionHierarchy::NO_MIDDLE
+        };
+
+        /**
+         * @brief Shortcut needed when contracting a node
+         */
+        struct ContractionShortcut
+        {
+            int from;
+            int to;
+            int weight;
+        };
+
+        // Nodes a witness search may settle before giving up and keeping the shortcut;
+        // priorities only need an estimate, so their searches give up sooner
+        constexpr int WITNESS_SETTLE_LIMIT = 500;
+        constexpr int PRIORITY_SETTLE_LIMIT = 25;
+
+        /**
+         * @brief Find the shortcuts contracting a node needs
+         *
+         * For every pair of neighbors, a local Dijkstra that avoids the node
+         * looks for a path no longer than the one through it. Giving up early
+         * only adds unneeded shortcuts, never wrong distances.
+         *
+         * @param arcs Remaining graph, indexed by node
+         * @param excluded Nonzero for nodes witness paths may not pass through
+         * @param node Node to contract
+         * @param settleLimit Nodes each witness search may settle
+         * @param workspace Scratch storage indexed by node (width = node count, height = 1)
+         * @param shortcuts Output list, cleared first
+         */
+        inline void findShortcuts(const std::vector<std::vector<ContractionArc>>& arcs,
+                                  const std::vector<std::uint8_t>& excluded,
+                                  int node,
+                                  int settleLimit,
+                                  SearchWorkspace& workspace,
+                                  std::vector<ContractionShortcut>& shortcuts)
+        {
+            shortcuts.clear();
+            const std::vector<ContractionArc>& neighbors = arcs[node];
+            const int neighborCount = static_cast<int>(neighbors.size());
+
+            for (int first = 0; first + 1 < neighborCount; ++first) {
+                int maxDistance = 0;
+                for (int second = first + 1; second < neighborCount; ++second) {
+                    maxDistance = std::max(maxDistance, neighbors[first].weight + neighbors[second].weight);
+                }
+
+                workspace.reset();
+                workspace.setDistance(neighbors[first].node, 0, 0, SearchWorkspace::NO_PARENT);
+                workspace.push(0, neighbors[first].node, 0);
+                int settled = 0;
+                int targetsLeft = neighborCount - first - 1;
+                while (!workspace.empty() && settled < settleLimit && targetsLeft > 0) {
+                    const auto [currentDist, current, row] = workspace.pop();
+                    if (currentDist > workspace.getDistance(current, 0)) {
+                        continue;
+                    }
+                    if (currentDist > maxDistance) {
+                        break;
+                    }
+                    ++settled;
+                    // Neighbors after first are the targets; their distances are final once settled
+                    for (int second = first + 1; second < neighborCount; ++second) {
+                        targetsLeft -= (neighbors[second].node == current);
+                    }
+
+                    for (const ContractionArc& arc : arcs[current]) {
+                        if (arc.node == node || excluded[arc.node]) {
+                            continue;
+                        }
+                        const int newDistance = currentDist + arc.weight;
+                        if (newDistance < workspace.getDistance(arc.node, 0)) {
+                            workspace.setDistance(arc.node, 0, newDistance, current);
+                            workspace.push(newDistance, arc.node, 0);
+                        }
+                    }
+                }
+
+                for (int second = first + 1; second < neighborCount; ++second) {
+                    const int viaNode = neighbors[first].weight + neighbors[second].weight;
+                    if (workspace.getDistance(neighbors[second].node, 0) > viaNode) {
+                        shortcuts.push_back({neighbors[first].node, neighbors[second].node, viaNode});
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Add an edge to the remaining graph, or shorten the existing one
+         * @param arcs Remaining graph, indexed by node
+         * @param from First node
+         * @param to Second node
+         * @param weight Edge length
+         * @param middle Contracted node the edge replaces
+         */
+        inline void addContractionArc(std::vector<std::vector<ContractionArc>>& arcs, int from, int to, int weight, int middle)
+        {
+            for (const auto& [source, target] : {std::make_tuple(from, to), std::make_tuple(to, from)}) {
+                auto existing = std::find_if(arcs[source].begin(), arcs[source].end(), [target = target](const ContractionArc& arc) {
+                    return arc.node == target;
+                });
+                if (existing == arcs[source].end()) {
+                    arcs[source].push_back({target, weight, middle});
+                } else if (weight < existing->weight) {
+                    *existing = {target, weight, middle};
+                }
+            }
+        }
+
+        /**
+         * @brief Run the upward searches of a contraction hierarchy query from both ends
+         *
+         * Each side only follows edges to higher ranks. A side stops once its
+         * smallest open distance reaches the best meeting distance.
+         *
+         * @param forward Scratch storage sized to the map, for the search from start
+         * @param backward Scratch storage sized to the map, for the search from goal
+         * @param hierarchy Contraction hierarchy
+         * @param start Start position
+         * @param goal Goal position
+         * @return Tuple of (distance, meeting node); (UNREACHABLE, NO_NODE) if no path exists
+         */
+        inline std::tuple<int, int> searchContractionHierarchy(SearchWorkspace& forward,
+                                                               SearchWorkspace& backward,
+                                                               const ContractionHierarchy& hierarchy,
+                                                               const Coord& start,
+                                                               const Coord& goal)
+        {
+            forward.reset();
+            backward.reset();
+
+            const auto [startX, startY] = start;
+            const auto [goalX, goalY] = goal;
+            if (hierarchy.getNode(startX, startY) == ContractionHierarchy::NO_NODE ||
+                hierarchy.getNode(goalX, goalY) == ContractionHierarchy::NO_NODE) {
+                return std::make_tuple(DijkstraMap::UNREACHABLE, ContractionHierarchy::NO_NODE);
+            }
+
+            const auto [width, height] = hierarchy.getDimensions();
+            forward.setDistance(startX, startY, 0, SearchWorkspace::NO_PARENT);
+            forward.push(0, startX, startY);
+            backward.setDistance(goalX, goalY, 0, SearchWorkspace::NO_PARENT);
+            backward.push(0, goalX, goalY);
+
+            int best = DijkstraMap::UNREACHABLE;
+            int meetingNode = ContractionHierarchy::NO_NODE;
+            auto smallestKey = [&best](const SearchWorkspace& workspace) {
+                if (workspace.empty()) {
+                    return best;
+                }
+                const auto [key, x, y] = workspace.top();
+                return key;
+            };
+
+            while (true) {
+                const int forwardKey = smallestKey(forward);
+                const int backwardKey = smallestKey(backward);
+                if (forwardKey >= best && backwardKey >= best) {
+                    break;
+                }
+
+                const bool forwardTurn = forwardKey <= backwardKey;
+                SearchWorkspace& side = forwardTurn ? forward : backward;
+                const SearchWorkspace& other = forwardTurn ? backward : forward;
+
+                const auto [currentDist, currentX, currentY] = side.pop();
+                if (currentDist > side.getDistance(currentX, currentY)) {
+                    continue;
+                }
+                side.countExpansion();
+
+                const int node = hierarchy.getNode(currentX, currentY);
+                const int otherDistance = other.getDistance(currentX, currentY);
+                if (otherDistance != DijkstraMap::UNREACHABLE && currentDist + otherDistance < best) {
+                    best = currentDist + otherDistance;
+                    meetingNode = node;
+                }
+
+                const int currentIndex = currentY * width + currentX;
+                const auto [firstEdge, lastEdge] = hierarchy.getEdgeRange(node);
+                for (int edge = firstEdge; edge < lastEdge; ++edge) {
+                    const ContractionHierarchy::Edge& upward = hierarchy.getEdge(edge);
+                    const auto [targetX, targetY] = hierarchy.getNodePosition(upward.target);
+                    const int newDistance = currentDist + upward.weight;
+                    if (newDistance < side.getDistance(targetX, targetY)) {
+                        side.setDistance(targetX, targetY, newDistance, currentIndex);
+                        side.push(newDistance, targetX, targetY);
+                    }
+                }
+            }
+
+            return std::make_tuple(best, meetingNode);
+        }
+
+        /**
+         * @brief Append the grid tiles an edge of a contraction hierarchy stands for
+         * @param hierarchy Contraction hierarchy
+         * @param from Node the edge is walked from, already on the path
+         * @param to Node the edge is walked to
+         * @param path Path to append to; gets every tile after from, up to and including to
+         */
+        inline void unpackContractionEdge(const ContractionHierarchy& hierarchy, int from, int to, CoordList& path)
+        {
+            std::vector<std::tuple<int, int>> pending = {{from, to}};
+            while (!pending.empty()) {
+                const auto [first, second] = pending.back();
+                pending.pop_back();
+
+                const int middle = hierarchy.getEdge(hierarchy.findEdge(first, second)).middle;
+                if (middle == ContractionHierarchy::NO_MIDDLE) {
+                    path.push_back(hierarchy.getNodePosition(second));
+                    continue;
+                }
+                // Stack order: the half next to first comes out first
+                pending.emplace_back(middle, second);
+                pending.emplace_back(first, middle);
+            }
+        }
+
+        /**
+         * @brief Check whether a step leads down the distance gradient toward the goal
+         * @param dijkstraMap Distances to the goal
+         * @param x X coordinate of a reachable tile
+         * @param y Y coordinate of a reachable tile
+         * @param direction Direction index into getDirections of the map's distance type
+         * @return True if the step starts a shortest path to the goal
+         */
+        inline bool isDescendingMove(const DijkstraMap& dijkstraMap, int x, int y, int direction)
+        {
+            const auto [dx, dy] = getDirections(dijkstraMap.getDistanceType())[direction];
+            const int stepCost = getStepCosts(dijkstraMap.getDistanceType())[direction];
+            return dijkstraMap.getDistance(x + dx, y + dy) == dijkstraMap.getDistance(x, y) - stepCost;
+        }
+
+        /**
+         * @brief Run-length encode the first moves of every tile toward one goal
+         *
+         * A tile keeps the move of the current run whenever that move is also
+         * optimal, so ties between equally short paths do not break runs.
+         * Non-walkable tiles and the goal are skipped and never start a run.
+         *
+         * @param dijkstraMap Distances to the goal
+         * @param walkable Walkable tiles
+         * @param goalTile Tile index of the goal
+         * @param runs Output (first tile, move) runs of the row, cleared first
+         */
+        inline void encodeFirstMoves(const DijkstraMap& dijkstraMap,
+                                     const BitGrid& walkable,
+                                     int goalTile,
+                                     std::vector<std::tuple<int, int>>& runs)
+        {
+            constexpr int noRun = PathDatabase::NO_MOVE - 1;
+            const auto [width, height] = dijkstraMap.getDimensions();
+            const int directionCount = static_cast<int>(getDirections(dijkstraMap.getDistanceType()).size());
+
+            runs.clear();
+            int currentMove = noRun;
+            for (int y = 0; y < height; ++y) {
+                const int* row = dijkstraMap.getRow(y);
+                for (int x = 0; x < width; ++x) {
+                    const int tile = y * width + x;
+                    if (!walkable.get(x, y) || tile == goalTile) {
+                        continue;
+                    }
+
+                    int move = PathDatabase::NO_MOVE;
+                    if (row[x] != DijkstraMap::UNREACHABLE) {
+                        if (currentMove >= 0 && isDescendingMove(dijkstraMap, x, y, currentMove)) {
+                            move = currentMove;
+                        } else {
+                            for (int direction = 0; direction < directionCount; ++direction) {
+                                if (isDescendingMove(dijkstraMap, x, y, direction)) {
+                                    move = direction;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    if (move != currentMove) {
+                        runs.emplace_back(runs.empty() ? 0 : tile, move);
+                        currentMove = move;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Run Dijkstra from one source until a number of target tiles are settled
+         * @param workspace Scratch storage sized to the map; holds the distances afterwards
+         * @param source Source position, walkable and within bounds
+         * @param targetTiles Tiles to settle
+         * @param targetCount Number of target tiles the source can reach
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         * @param distType Distance type selecting connectivity and step costs
+         */
+        template<typename WalkableFunc>
+        void settleTargets(SearchWorkspace& workspace,
+                           const Coord& source,
+                           const BitGrid& targetTiles,
+                           int targetCount,
+                           WalkableFunc isWalkable,
+                           DistanceType distType)
+        {
+            workspace.reset();
+            if (targetCount <= 0) {
+                return;
+            }
+
+            const auto [sourceX, sourceY] = source;
+            workspace.setDistance(sourceX, sourceY, 0, SearchWorkspace::NO_PARENT);
+            workspace.push(0, sourceX, sourceY);
+
+            int settledTargets = 0;
+            settleWorkspace(workspace, isWalkable, distType, std::numeric_limits<int>::max(),
+                            [](int, int) { return 0; },
+                            [&](int x, int y, int) {
+                                settledTargets += targetTiles.get(x, y) ? 1 : 0;
+                                return settledTargets < targetCount;
+                            });
+        }
+
+        /**
+         * @brief Offer a goal distance to the sorted slots of a tile
+         *
+         * Slots stay sorted by (distance, goal ID) and hold each goal at most
+         * once. The entry is dropped if the tile already knows the goal at no
+         * greater distance, or if all slots hold nearer goals.
+         *
+         * @param slots The K slots of the tile
+         * @param distance Distance to the goal
+         * @param goal Goal ID
+         * @return True if the slots changed
+         */
+        template<int K>
+        bool insertNearestGoal(typename NearestGoalsMap<K>::Slot* slots, int distance, int goal)
+        {
+            auto precedes = [](int distance1, int goal1, int distance2, int goal2) {
+                return distance1 < distance2 || (distance1 == distance2 && goal1 < goal2);
+            };
+
+            // Slot to vacate: the goal's own slot, or else the farthest one
+            int position = K - 1;
+            const auto known = std::find_if(slots, slots + K, [goal](const auto& slot) { return slot.goal == goal; });
+            if (known != slots + K) {
+                if (known->distance <= distance) {
+                    return false;
+                }
+                position = static_cast<int>(known - slots);
+            } else if (!precedes(distance, goal, slots[K - 1].distance, slots[K - 1].goal)) {
+                return false;
+            }
+
+            for (; position > 0 && precedes(distance, goal, slots[position - 1].distance, slots[position - 1].goal);
+                 --position) {
+                slots[position] = slots[position - 1];
+            }
+            slots[position] = {distance, goal};
+            return true;
+        }
+
+        /**
+         * @brief Mark the tiles of a row whose distance lies in a band
+         *
+         * Branch-free and split into fixed-size blocks, so the compiler
+         * vectorizes the block loop even at -O2. Unsigned wraparound makes the
+         * band test a single compare that is also correct for negative bounds.
+         *
+         * @param row Distances of the row
+         * @param width Number of tiles in the row
+         * @param minDistance Smallest distance of the band
+         * @param maxDistance Largest distance of the band, inclusive, at least minDistance
+         * @param inBand Output flag per tile: 1 if in the band, 0 otherwise
+         * @return Number of tiles in the band
+         */
+        inline int markBandRow(const int* row, int width, int minDistance, int maxDistance, std::uint8_t* inBand)
+        {
+            constexpr int blockSize = 32;
+            const unsigned offset = static_cast<unsigned>(minDistance);
+            const unsigned range = static_cast<unsigned>(maxDistance) - offset;
+
+            auto isInBand = [offset, range](int distance) {
+                return (static_cast<unsigned>(distance) - offset <= range) & (distance != DijkstraMap::UNREACHABLE);
+            };
+
+            int count = 0;
+            int x = 0;
+            for (; x + blockSize <= width; x += blockSize) {
+                // Flags go to a local block first: byte stores to inBand could alias row
+                std::uint8_t block[blockSize];
+                for (int i = 0; i < blockSize; ++i) {
+                    block[i] = isInBand(row[x + i]);
+                    count += block[i];
+                }
+                std::memcpy(inBand + x, block, blockSize);
+            }
+            for (; x < width; ++x) {
+                inBand[x] = isInBand(row[x]);
+                count += inBand[x];
+            }
+            return count;
+        }
+
+        /**
+         * @brief Skip a run of equal band flags
+         * @param flags Flag per tile, 0 or 1
+         * @param x Tile to start at
+         * @param width Number of flags
+         * @param flag Flag value to skip
+         * @return First tile at or after x whose flag differs, or width
+         */
+        inline int skipBandFlags(const std::uint8_t* flags, int x, int width, std::uint8_t flag)
+        {
+            // Compare eight flags per step while the whole chunk matches
+            const std::uint64_t chunkPattern = 0x0101010101010101ull * flag;
+            for (; x + 8 <= width; x += 8) {
+                std::uint64_t chunk;
+                std::memcpy(&chunk, flags + x, sizeof(chunk));
+                if (chunk != chunkPattern) {
+                    break;
+                }
+            }
+            while (x < width && flags[x] == flag) {
+                ++x;
+            }
+            return x;
+        }
+
+        /**
+         * @brief Find the largest reachable distance of a row
+         *
+         * Adding one with unsigned wraparound turns UNREACHABLE into the
+         * smallest int, so the reduction is a plain max over fixed-size
+         * blocks, like markBandRow.
+         *
+         * @param row Distances of the row
+         * @param width Number of tiles in the row
+         * @return Largest distance other than UNREACHABLE, or the smallest int if there is none
+         */
+        inline int findRowMaxDistance(const int* row, int width)
+        {
+            constexpr int blockSize = 32;
+            constexpr int none = std::numeric_limits<int>::min();
+
+            auto shifted = [](int distance) {
+                return static_cast<int>(static_cast<unsigned>(distance) + 1u);
+            };
+
+            int maxShifted = none;
+            int x = 0;
+            for (; x + blockSize <= width; x += blockSize) {
+                int blockMax = none;
+                for (int i = 0; i < blockSize; ++i) {
+                    blockMax = std::max(blockMax, shifted(row[x + i]));
+                }
+                maxShifted = std::max(maxShifted, blockMax);
+            }
+            for (; x < width; ++x) {
+                maxShifted = std::max(maxShifted, shifted(row[x]));
+            }
+            return (maxShifted == none) ? none : maxShifted - 1;
+        }
+
+        /**
+         * @brief Get the direction pointing back along a step
+         * @param direction Direction index into getDirections
+         * @return Index of the opposite direction
+         */
+        inline int getOppositeDirection(int direction)
+        {
+            static const std::vector<int> opposites = [] {
+                const CoordList& directions = DijkstraMap::getMovementDirections();
+                std::vector<int> result(directions.size());
+                for (std::size_t index = 0; index < directions.size(); ++index) {
+                    const auto [dx, dy] = directions[index];
+                    const auto opposite = std::find(directions.begin(), directions.end(), Coord(-dx, -dy));
+                    result[index] = static_cast<int>(opposite - directions.begin());
+                }
+                return result;
+            }();
+            return opposites[direction];
+        }
+
+        /**
+         * @brief Flood fill from goals over a bucket queue, settling tiles level by level
+         * @param dijkstraMap The map to populate with distances, already cleared
+         * @param goals Vector of goal positions (distance 0)
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         * @param settle Function called once per settled tile: void(int x, int y, int distance)
+         * @param reach Function called for every step that does not lengthen the distance of a
+         *              neighbor, before the distance is updated: void(int x, int y, int direction, int distance)
+         */
+        template<typename WalkableFunc, typename SettleFunc, typename ReachFunc>
+        void propagateByLevels(DijkstraMap& dijkstraMap,
+                               const CoordList& goals,
+                               WalkableFunc isWalkable,
+                               SettleFunc settle,
+                               ReachFunc reach)
+        {
+            const auto [width, height] = dijkstraMap.getDimensions();
+            const auto& directions = getDirections(dijkstraMap.getDistanceType());
+            const auto& stepCosts = getStepCosts(dijkstraMap.getDistanceType());
+            const int directionCount = static_cast<int>(directions.size());
+
+            BucketQueue queue(*std::max_element(stepCosts.begin(), stepCosts.end()));
+            for (const auto& [goalX, goalY] : goals) {
+                if (dijkstraMap.isWithinBounds(goalX, goalY) && isWalkable(goalX, goalY)
+                    && dijkstraMap.getDistance(goalX, goalY) != 0) {
+                    dijkstraMap.setDistance(goalX, goalY, 0);
+                    queue.push(0, goalY * width + goalX);
+                }
+            }
+
+            while (!queue.empty()) {
+                const auto [currentDist, currentIndex] = queue.pop();
+                const int currentX = currentIndex % width;
+                const int currentY = currentIndex / width;
+
+                if (currentDist > dijkstraMap.getDistance(currentX, currentY)) {
+                    continue;
+                }
+                settle(currentX, currentY, currentDist);
+
+                for (int direction = 0; direction < directionCount; ++direction) {
+                    const auto [dx, dy] = directions[direction];
+                    const int neighborX = currentX + dx;
+                    const int neighborY = currentY + dy;
+                    if (!dijkstraMap.isWithinBounds(neighborX, neighborY) || !isWalkable(neighborX, neighborY)) {
+                        continue;
+                    }
+
+                    const int newDistance = currentDist + stepCosts[direction];
+                    const int oldDistance = dijkstraMap.getDistance(neighborX, neighborY);
+                    if (newDistance <= oldDistance) {
+                        reach(neighborX, neighborY, direction, newDistance);
+                    }
+                    if (newDistance < oldDistance) {
+                        dijkstraMap.setDistance(neighborX, neighborY, newDistance);
+                        queue.push(newDistance, neighborY * width + neighborX);
+                    }
+                }
+            }
+        }
+
+        // Tiles per block of the flow row kernel
+        constexpr int FLOW_BLOCK_SIZE = 32;
+
+        /**
+         * @brief Keep a step if it beats the best one found so far, without branching
+         * @param neighbor Distance of the neighbor the step leads to
+         * @param discount Largest step cost minus the cost of this step
+         * @param direction Direction index of the step
+         * @param best Smallest neighbor distance minus discount so far
+         * @param bestDirection Direction of best
+         */
+        inline void considerFlowStep(int neighbor, int discount, int direction, int& best, int& bestDirection)
+        {
+            // Subtracting rather than adding the step cost keeps UNREACHABLE from overflowing
+            const int candidate = neighbor - discount;
+            const bool better = candidate < best;
+            bestDirection = better ? direction : bestDirection;
+            best = better ? candidate : best;
+        }
+
+        /**
+         * @brief Find the first step of a shortest path from a tile toward the goals
+         *
+         * Bounds-checked version of the row kernel, for tiles it does not cover.
+         *
+         * @param dijkstraMap Distances to the goals
+         * @param x X coordinate
+         * @param y Y coordinate
+         * @return Lowest direction index whose neighbor distance plus step cost is minimal
+         *         and no larger than the tile's distance, or FlowField::NO_DIRECTION
+         */
+        inline int findFlowDirection(const DijkstraMap& dijkstraMap, int x, int y)
+        {
+            const auto& directions = getDirections(dijkstraMap.getDistanceType());
+            const auto& stepCosts = getStepCosts(dijkstraMap.getDistanceType());
+            const int maxCost = *std::max_element(stepCosts.begin(), stepCosts.end());
+            const int distance = dijkstraMap.getDistance(x, y);
+            if (distance == DijkstraMap::UNREACHABLE) {
+                return FlowField::NO_DIRECTION;
+            }
+
+            int best = DijkstraMap::UNREACHABLE;
+            int bestDirection = FlowField::NO_DIRECTION;
+            for (int direction = 0; direction < static_cast<int>(directions.size()); ++direction) {
+                const auto [dx, dy] = directions[direction];
+                considerFlowStep(dijkstraMap.getDistance(x + dx, y + dy), maxCost - stepCosts[direction],
+                                 direction, best, bestDirection);
+            }
+            return (best <= distance - maxCost) ? bestDirection : FlowField::NO_DIRECTION;
+        }
+
+        /**
+         * @brief Compute the flow directions of the inner tiles of a row
+         *
+         * Same result as findFlowDirection for tiles 1 to width - 2. The
+         * neighbor minimum is branch-free and split into fixed-size blocks.
+         * The last block is moved back to end at the row end, recomputing a
+         * few tiles rather than leaving a scalar tail.
+         *
+         * @tparam Diagonal True to consider the four diagonal directions too
+         * @param above Distances of the row above, all UNREACHABLE for the first row
+         * @param row Distances of the row
+         * @param below Distances of the row below, all UNREACHABLE for the last row
+         * @param width Number of tiles in the row, at least FLOW_BLOCK_SIZE + 2
+         * @param straightCost Step cost of the straight directions
+         * @param diagonalCost Step cost of the diagonal directions, equal to straightCost if Diagonal is false
+         * @param flow Output direction bytes of the row; the first and last tile are not written
+         */
+        template<bool Diagonal>
+        void computeFlowRow(const int* above,
+                            const int* row,
+                            const int* below,
+                            int width,
+                            int straightCost,
+                            int diagonalCost,
+                            std::uint8_t* flow)
+        {
+            // Diagonal steps cost the most, so only straight steps get a discount
+            const int straightDiscount = diagonalCost - straightCost;
+
+            for (int blockStart = 1; blockStart + 1 < width; blockStart += FLOW_BLOCK_SIZE) {
+                const int x = std::min(blockStart, width - 1 - FLOW_BLOCK_SIZE);
+                // Directions go to a local block first: byte stores to flow could alias the rows
+                std::uint8_t block[FLOW_BLOCK_SIZE];
+                for (int i = 0; i < FLOW_BLOCK_SIZE; ++i) {
+                    const int tile = x + i;
+                    int best = below[tile] - straightDiscount;
+                    int bestDirection = 0;
+                    considerFlowStep(above[tile], straightDiscount, 1, best, bestDirection);
+                    considerFlowStep(row[tile + 1], straightDiscount, 2, best, bestDirection);
+                    considerFlowStep(row[tile - 1], straightDiscount, 3, best, bestDirection);
+                    if (Diagonal) {
+                        considerFlowStep(below[tile + 1], 0, 4, best, bestDirection);
+                        considerFlowStep(above[tile + 1], 0, 5, best, bestDirection);
+                        considerFlowStep(below[tile - 1], 0, 6, best, bestDirection);
+                        considerFlowStep(above[tile - 1], 0, 7, best, bestDirection);
+                    }
+                    const bool descends = (row[tile] != DijkstraMap::UNREACHABLE) & (best <= row[tile] - diagonalCost);
+                    block[i] = static_cast<std::uint8_t>(descends ? bestDirection : FlowField::NO_DIRECTION_BYTE);
+                }
+                std::memcpy(flow + x, block, FLOW_BLOCK_SIZE);
+            }
+        }
+
+        // Tiles per block of the map combination kernel
+        constexpr int COMBINE_BLOCK_SIZE = 32;
+
+        /**
+         * @brief Combine one row of maps that share the output's dimensions
+         *
+         * Same result as CombinedMapView::getDistance. Each block of tiles
+         * keeps its sums and unreachable flags in local arrays while the terms
+         * stream through, so the output may be one of the terms.
+         *
+         * @param terms Weighted maps, all as wide as the row
+         * @param y Row index
+         * @param width Number of tiles in the row
+         * @param out Output distances of the row
+         */
+        inline void combineRow(const std::vector<WeightedMap>& terms, int y, int width, int* out)
+        {
+            int x = 0;
+            for (; x + COMBINE_BLOCK_SIZE <= width; x += COMBINE_BLOCK_SIZE) {
+                double sums[COMBINE_BLOCK_SIZE] = {};
+                int unreachable[COMBINE_BLOCK_SIZE] = {};
+                for (const WeightedMap& term : terms) {
+                    const int* row = term.map.getRow(y) + x;
+                    const double weight = term.weight;
+                    for (int i = 0; i < COMBINE_BLOCK_SIZE; ++i) {
+                        sums[i] += weight * row[i];
+                        unreachable[i] |= (row[i] == DijkstraMap::UNREACHABLE);
+                    }
+                }
+
+                int block[COMBINE_BLOCK_SIZE];
+                for (int i = 0; i < COMBINE_BLOCK_SIZE; ++i) {
+                    const int rounded = CombinedMapView::roundDistance(sums[i]);
+                    block[i] = unreachable[i] ? DijkstraMap::UNREACHABLE : rounded;
+                }
+                std::memcpy(out + x, block, sizeof(block));
+            }
+
+            for (; x < width; ++x) {
+                double sum = 0.0;
+                bool unreachable = false;
+                for (const WeightedMap& term : terms) {
+                    const int distance = term.map.getRow(y)[x];
+                    sum += term.weight * distance;
+                    unreachable |= (distance == DijkstraMap::UNREACHABLE);
+                }
+                out[x] = unreachable ? DijkstraMap::UNREACHABLE : CombinedMapView::roundDistance(sum);
+            }
+        }
+
+        /**
+         * @brief Compute the fixed-point influence of a source at a distance
+         *
+         * An exponential falloff without a positive half-life is the limit of
+         * ever shorter half-lives: full strength on the source, none elsewhere.
+         *
+         * @param strength Influence on the source tile
+         * @param distance Distance from the source, in [0, falloff.cutoff]
+         * @param falloff Falloff shape and parameters
+         * @return Influence in InfluenceMap raw units, saturated to the int range
+         */
+        inline int computeInfluence(double strength, int distance, const InfluenceFalloff& falloff)
+        {
+            double decay = 1.0;
+            if (falloff.type == FalloffType::Exponential) {
+                if (falloff.halfLife > 0.0) {
+                    decay = std::exp2(-distance / falloff.halfLife);
+                } else {
+                    decay = (distance == 0) ? 1.0 : 0.0;
+                }
+            } else if (falloff.cutoff > 0) {
+                decay = 1.0 - static_cast<double>(distance) / falloff.cutoff;
+            }
+
+            const double influence = strength * decay * InfluenceMap::FIXED_POINT_SCALE;
+            return static_cast<int>(std::lround(std::min(static_cast<double>(std::numeric_limits<int>::max()),
+                                                         std::max(static_cast<double>(std::numeric_limits<int>::min()),
+                                                                  influence))));
+        }
+
+        /**
+         * @brief Get the side of the square that holds every tile a source can influence
+         * @param cutoff Largest distance a source reaches
+         * @param distType Distance type selecting step costs
+         * @return Window side in tiles, before clipping to the map
+         */
+        inline std::int64_t getInfluenceWindowSide(int cutoff, DistanceType distType)
+        {
+            // Every step moves at most one tile and costs at least a straight step
+            const std::int64_t radius = std::max(0, cutoff) / getStepCosts(distType)[0];
+            return 2 * radius + 1;
+        }
+
+        /**
+         * @brief Add the influence of one source to every tile within the cutoff
+         *
+         * A Dijkstra flood fill from the source that stops at the cutoff, so
+         * its cost depends on the cutoff area rather than the map size. The
+         * workspace only covers a window around the source that holds every
+         * tile within the cutoff.
+         *
+         * @param workspace Scratch storage sized to the window, at most the map size
+         * @param width Width of the map
+         * @param height Height of the map
+         * @param source Source, walkable and within bounds
+         * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+         * @param distType Distance type selecting connectivity and step costs
+         * @param falloff Falloff shape and cutoff
+         * @param addInfluence Function receiving each tile's fixed-point influence: void(int x, int y, int influence)
+         */
+        template<typename WalkableFunc, typename AddFunc>
+        void spreadInfluence(SearchWorkspace& workspace,
+                             int width,
+                             int height,
+                             const InfluenceSource& source,
+                             WalkableFunc isWalkable,
+                             DistanceType distType,
+                             const InfluenceFalloff& falloff,
+                             AddFunc addInfluence)
+        {
+            workspace.reset();
+            if (falloff.cutoff < 0) {
+                return;
+            }
+
+            const auto [windowWidth, windowHeight] = workspace.getDimensions();
+            const int windowX = std::clamp(source.x - windowWidth / 2, 0, width - windowWidth);
+            const int windowY = std::clamp(source.y - windowHeight / 2, 0, height - windowHeight);
+            const auto& stepCosts = getStepCosts(distType);
+            // Settled distances stay within the cutoff, so one more step never overflows
+            const int cutoff = std::min(falloff.cutoff,
+                                        std::numeric_limits<int>::max() - *std::max_element(stepCosts.begin(), stepCosts.end()));
+
+            workspace.setDistance(source.x - windowX, source.y - windowY, 0, SearchWorkspace::NO_PARENT);
+            workspace.push(0, source.x - windowX, source.y - windowY);
+
+            settleWorkspace(workspace,
+                            [&](int x, int y) { return isWalkable(windowX + x, windowY + y); },
+                            distType, cutoff,
+                            [](int, int) { return 0; },
+                            [&](int x, int y, int distance) {
+                                addInfluence(windowX + x, windowY + y, computeInfluence(source.strength, distance, falloff));
+                                return true;
+                            });
+        }
+    } // namespace detail
+    
+    /**
+     * @brief Generate a Dijkstra map using flood-fill from goal positions
+     *
+     * @param dijkstraMap The map to populate with distances
+     * @param goals Vector of goal positions (distance 0)
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     */
+    template<typename WalkableFunc>
+    void generateDijkstraMap(DijkstraMap& dijkstraMap,
+                           const CoordList& goals,
+                           WalkableFunc isWalkable)
+    {
+        dijkstraMap.clear();
+
+        // Priority queue for processing tiles: (distance, x, y)
+        PriorityQueue queue;
+
+        // Initialize goals
+        detail::initializeGoals(dijkstraMap, goals, isWalkable, queue);
+
+        // Dijkstra flood-fill algorithm
+        detail::propagateDistances(dijkstraMap, isWalkable, queue);
+    }
+    
+    /**
+     * @brief Find all unreachable tiles in a map
+     *
+     * @param dijkstraMap The Dijkstra map to analyze
+     * @param isWalkable Function to determine if a tile should be walkable: bool(int x, int y)
+     * @return Vector of unreachable tile coordinates
+     */
+    template<typename WalkableFunc>
+    CoordList findUnreachableTiles(const DijkstraMap& dijkstraMap, WalkableFunc isWalkable)
+    {
+        CoordList unreachableTiles;
+        const auto [width, height] = dijkstraMap.getDimensions();
+
+        for (int x = 0; x < width; ++x) {
+            for (int y = 0; y < height; ++y) {
+                if (isWalkable(x, y) && !dijkstraMap.isReachable(x, y)) {
+                    unreachableTiles.emplace_back(x, y);
+                }
+            }
+        }
+
+        return unreachableTiles;
+    }
+
+    /**
+     * @brief Visit every unreachable tile without materializing a list
+     *
+     * Tiles are visited in row-major order (y outer, x inner).
+     *
+     * @param dijkstraMap The Dijkstra map to analyze
+     * @param isWalkable Function to determine if a tile should be walkable: bool(int x, int y)
+     * @param visit Callback invoked per unreachable tile: void(int x, int y)
+     */
+    template<typename WalkableFunc, typename VisitorFunc>
+    void forEachUnreachableTile(const DijkstraMap& dijkstraMap, WalkableFunc isWalkable, VisitorFunc visit)
+    {
+        const auto [width, height] = dijkstraMap.getDimensions();
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (isWalkable(x, y) && !dijkstraMap.isReachable(x, y)) {
+                    visit(x, y);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Visit every maximal horizontal run of unreachable tiles
+     *
+     * Spans are visited row by row, left to right.
+     *
+     * @param dijkstraMap The Dijkstra map to analyze
+     * @param isWalkable Function to determine if a tile should be walkable: bool(int x, int y)
+     * @param visit Callback invoked per span: void(int y, int xBegin, int xEnd), xEnd exclusive
+     */
+    template<typename WalkableFunc, typename SpanVisitorFunc>
+    void forEachUnreachableSpan(const DijkstraMap& dijkstraMap, WalkableFunc isWalkable, SpanVisitorFunc visit)
+    {
+        const auto [width, height] = dijkstraMap.getDimensions();
+
+        for (int y = 0; y < height; ++y) {
+            int spanBegin = -1;
+            for (int x = 0; x < width; ++x) {
+                const bool unreachable = isWalkable(x, y) && !dijkstraMap.isReachable(x, y);
+                if (unreachable && spanBegin < 0) {
+                    spanBegin = x;
+                } else if (!unreachable && spanBegin >= 0) {
+                    visit(y, spanBegin, x);
+                    spanBegin = -1;
+                }
+            }
+
+            if (spanBegin >= 0) {
+                visit(y, spanBegin, width);
+            }
+        }
+    }
+
+    /**
+     * @brief Find all unreachable tiles as run-length spans per row
+     *
+     * @param dijkstraMap The Dijkstra map to analyze
+     * @param isWalkable Function to determine if a tile should be walkable: bool(int x, int y)
+     * @return Spans of unreachable tiles, row by row
+     */
+    template<typename WalkableFunc>
+    std::vector<TileSpan> findUnreachableSpans(const DijkstraMap& dijkstraMap, WalkableFunc isWalkable)
+    {
+        std::vector<TileSpan> unreachableSpans;
+        forEachUnreachableSpan(dijkstraMap, isWalkable, [&](int y, int xBegin, int xEnd) {
+            unreachableSpans.push_back({y, xBegin, xEnd});
+        });
+        return unreachableSpans;
+    }
+
+    /**
+     * @brief Mark all unreachable tiles in a bitmap
+     *
+     * The bitmap is cleared first, and resized if its dimensions differ from the map.
+     *
+     * @param dijkstraMap The Dijkstra map to analyze
+     * @param isWalkable Function to determine if a tile should be walkable: bool(int x, int y)
+     * @param unreachableTiles Bitmap receiving one set bit per unreachable tile
+     */
+    template<typename WalkableFunc>
+    void markUnreachableTiles(const DijkstraMap& dijkstraMap, WalkableFunc isWalkable, BitGrid& unreachableTiles)
+    {
+        const auto [width, height] = dijkstraMap.getDimensions();
+        if (unreachableTiles.getDimensions() != dijkstraMap.getDimensions()) {
+            unreachableTiles = BitGrid(width, height);
+        } else {
+            unreachableTiles.clear();
+        }
+
+        forEachUnreachableSpan(dijkstraMap, isWalkable, [&](int y, int xBegin, int xEnd) {
+            unreachableTiles.setSpan(y, xBegin, xEnd);
+        });
+    }
+    
+    /**
+     * @brief Generate Dijkstra map from a single goal position
+     *
+     * @param dijkstraMap The map to populate
+     * @param goalX Goal X coordinate
+     * @param goalY Goal Y coordinate
+     * @param isWalkable Function to determine walkable tiles
+     */
+    template<typename WalkableFunc>
+    void generateDijkstraMapFromSingleGoal(DijkstraMap& dijkstraMap,
+                                         int goalX,
+                                         int goalY,
+                                         WalkableFunc isWalkable)
+    {
+        generateDijkstraMap(dijkstraMap, {{goalX, goalY}}, isWalkable);
+    }
+
+    /**
+     * @brief Label the connected components of a walkability grid
+     *
+     * Uses a two-pass scanline labeler with union-find, so no distances are
+     * computed. Connectivity follows the movement pattern of the distance type.
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type selecting 4- or 8-directional connectivity
+     * @return Component label per tile
+     */
+    template<typename WalkableFunc>
+    ComponentLabels labelComponents(int width,
+                                   int height,
+                                   WalkableFunc isWalkable,
+                                   DistanceType distType = DistanceType::Euclidean)
+    {
+        ComponentLabels components(width, height);
+        const auto& precedingDirections = detail::getPrecedingDirections(distType);
+
+        // First pass: provisional labels, merging sets where earlier neighbors meet
+        std::vector<int> parents;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (!isWalkable(x, y)) {
+                    continue;
+                }
+
+                int label = ComponentLabels::NO_COMPONENT;
+                for (const auto& [dx, dy] : precedingDirections) {
+                    const int neighborLabel = components.getLabel(x + dx, y + dy);
+                    if (neighborLabel == ComponentLabels::NO_COMPONENT) {
+                        continue;
+                    }
+                    label = (label == ComponentLabels::NO_COMPONENT)
+                        ? detail::findRoot(parents, neighborLabel)
+                        : detail::uniteSets(parents, label, neighborLabel);
+                }
+
+                if (label == ComponentLabels::NO_COMPONENT) {
+                    label = static_cast<int>(parents.size());
+                    parents.push_back(label);
+                }
+                components.setLabel(x, y, label);
+            }
+        }
+
+        // Second pass: replace provisional labels with dense component IDs
+        std::vector<int> componentIds(parents.size(), ComponentLabels::NO_COMPONENT);
+        std::vector<int> componentSizes;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const int label = components.getLabel(x, y);
+                if (label == ComponentLabels::NO_COMPONENT) {
+                    continue;
+                }
+
+                int& componentId = componentIds[detail::findRoot(parents, label)];
+                if (componentId == ComponentLabels::NO_COMPONENT) {
+                    componentId = static_cast<int>(componentSizes.size());
+                    componentSizes.push_back(0);
+                }
+                ++componentSizes[componentId];
+                components.setLabel(x, y, componentId);
+            }
+        }
+
+        components.setComponentSizes(std::move(componentSizes));
+        return components;
+    }
+
+    /**
+     * @brief Check if a tile is reachable from any goal using component labels
+     *
+     * @param components Component labels of the map
+     * @param x X coordinate of the tile
+     * @param y Y coordinate of the tile
+     * @param goals Goal positions; non-walkable or out-of-bounds goals are ignored
+     * @return True if the tile shares a component with at least one goal
+     */
+    inline bool isReachableFromGoals(const ComponentLabels& components,
+                                     int x,
+                                     int y,
+                                     const CoordList& goals)
+    {
+        const int label = components.getLabel(x, y);
+        if (label == ComponentLabels::NO_COMPONENT) {
+            return false;
+        }
+
+        return std::any_of(goals.begin(), goals.end(), [&](const Coord& goal) {
+            const auto [goalX, goalY] = goal;
+            return components.getLabel(goalX, goalY) == label;
+        });
+    }
+
+    /**
+     * @brief Find all components that contain no goal
+     *
+     * @param components Component labels of the map
+     * @param goals Goal positions; non-walkable or out-of-bounds goals are ignored
+     * @return IDs of the unreachable components, in ascending order
+     */
+    inline std::vector<int> findUnreachableComponents(const ComponentLabels& components,
+                                                      const CoordList& goals)
+    {
+        std::vector<bool> reached(components.getComponentCount(), false);
+        for (const auto& [goalX, goalY] : goals) {
+            const int label = components.getLabel(goalX, goalY);
+            if (label != ComponentLabels::NO_COMPONENT) {
+                reached[label] = true;
+            }
+        }
+
+        std::vector<int> unreachableComponents;
+        for (int componentId = 0; componentId < components.getComponentCount(); ++componentId) {
+            if (!reached[componentId]) {
+                unreachableComponents.push_back(componentId);
+            }
+        }
+        return unreachableComponents;
+    }
+
+    /**
+     * @brief Find all walkable tiles that no goal can reach, without generating distances
+     *
+     * @param components Component labels of the map
+     * @param goals Goal positions; non-walkable or out-of-bounds goals are ignored
+     * @return Vector of unreachable tile coordinates
+     */
+    inline CoordList findUnreachableTiles(const ComponentLabels& components, const CoordList& goals)
+    {
+        const std::vector<int> unreachableComponents = findUnreachableComponents(components, goals);
+        std::vector<bool> isUnreachable(components.getComponentCount(), false);
+        int unreachableCount = 0;
+        for (const int componentId : unreachableComponents) {
+            isUnreachable[componentId] = true;
+            unreachableCount += components.getComponentSize(componentId);
+        }
+
+        CoordList unreachableTiles;
+        unreachableTiles.reserve(unreachableCount);
+        const auto [width, height] = components.getDimensions();
+
+        for (int x = 0; x < width; ++x) {
+            for (int y = 0; y < height; ++y) {
+                const int label = components.getLabel(x, y);
+                if (label != ComponentLabels::NO_COMPONENT && isUnreachable[label]) {
+                    unreachableTiles.emplace_back(x, y);
+                }
+            }
+        }
+
+        return unreachableTiles;
+    }
+
+    /**
+     * @brief Pack a walkability function into a bit grid
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @return Grid with one set bit per walkable tile
+     */
+    template<typename WalkableFunc>
+    BitGrid buildWalkabilityGrid(int width, int height, WalkableFunc isWalkable)
+    {
+        BitGrid walkable(width, height);
+
+        for (int y = 0; y < height; ++y) {
+            BitGrid::Word* row = walkable.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                if (isWalkable(x, y)) {
+                    row[x / BitGrid::BITS_PER_WORD] |= BitGrid::Word{1} << (x % BitGrid::BITS_PER_WORD);
+                }
+            }
+        }
+
+        return walkable;
+    }
+
+    /**
+     * @brief Compute which tiles are reachable from the goals, without distances
+     *
+     * Bit-parallel flood fill: rows are swept down and up, pulling reached bits
+     * from the adjacent row and filling walkable runs 64 tiles per word, until a
+     * sweep changes nothing.
+     *
+     * @param walkable Walkability grid
+     * @param goals Goal positions; non-walkable or out-of-bounds goals are ignored
+     * @param distType Distance type selecting 4- or 8-directional connectivity
+     * @return Grid with one set bit per reachable tile
+     */
+    inline BitGrid computeReachable(const BitGrid& walkable,
+                                    const CoordList& goals,
+                                    DistanceType distType = DistanceType::Euclidean)
+    {
+        const auto [width, height] = walkable.getDimensions();
+        BitGrid reachable(width, height);
+
+        for (const auto& [goalX, goalY] : goals) {
+            if (walkable.get(goalX, goalY)) {
+                reachable.set(goalX, goalY);
+            }
+        }
+
+        const bool diagonal = detail::usesDiagonalMovement(distType);
+        const int wordCount = walkable.getWordsPerRow();
+        std::vector<BitGrid::Word> scratch(wordCount);
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int y = 0; y < height; ++y) {
+                const BitGrid::Word* above = (y > 0) ? reachable.getRow(y - 1) : nullptr;
+                changed |= detail::relaxReachableRow(reachable.getRow(y), above, walkable.getRow(y),
+                                                     wordCount, diagonal, scratch);
+            }
+            for (int y = height - 1; y >= 0; --y) {
+                const BitGrid::Word* below = (y + 1 < height) ? reachable.getRow(y + 1) : nullptr;
+                changed |= detail::relaxReachableRow(reachable.getRow(y), below, walkable.getRow(y),
+                                                     wordCount, diagonal, scratch);
+            }
+        }
+
+        return reachable;
+    }
+
+    /**
+     * @brief Compute which tiles are reachable from the goals, without distances
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param goals Goal positions; non-walkable or out-of-bounds goals are ignored
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type selecting 4- or 8-directional connectivity
+     * @return Grid with one set bit per reachable tile
+     */
+    template<typename WalkableFunc>
+    BitGrid computeReachable(int width,
+                             int height,
+                             const CoordList& goals,
+                             WalkableFunc isWalkable,
+                             DistanceType distType = DistanceType::Euclidean)
+    {
+        return computeReachable(buildWalkabilityGrid(width, height, isWalkable), goals, distType);
+    }
+
+    /**
+     * @brief Generate a separate Dijkstra map for each source in one bit-parallel pass
+     *
+     * Sources are processed in batches of 64; each batch runs a single
+     * breadth-first search where every bit of a per-tile mask tracks one source.
+     * Distance types without unit step costs (Octile) fall back to one
+     * generateDijkstraMap call per source.
+     *
+     * @param width Width of the maps
+     * @param height Height of the maps
+     * @param sources Source positions; non-walkable or out-of-bounds sources yield all-UNREACHABLE maps
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type of the generated maps
+     * @return One Dijkstra map per source, in source order
+     */
+    template<typename WalkableFunc>
+    std::vector<DijkstraMap> generatePerSourceDijkstraMaps(int width,
+                                                          int height,
+                                                          const CoordList& sources,
+                                                          WalkableFunc isWalkable,
+                                                          DistanceType distType = DistanceType::Euclidean)
+    {
+        std::vector<DijkstraMap> dijkstraMaps(sources.size(), DijkstraMap(width, height, distType));
+
+        // Bit-parallel BFS needs unit step costs; other metrics get one generation per source
+        if (!detail::hasUnitStepCosts(distType)) {
+            for (std::size_t i = 0; i < sources.size(); ++i) {
+                generateDijkstraMap(dijkstraMaps[i], {sources[i]}, isWalkable);
+            }
+            return dijkstraMaps;
+        }
+
+        std::vector<char> walkable(static_cast<std::size_t>(width) * height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                walkable[static_cast<std::size_t>(y) * width + x] = isWalkable(x, y);
+            }
+        }
+
+        const auto& directions = detail::getDirections(distType);
+        constexpr int lanesPerBatch = 64;
+        const int sourceCount = static_cast<int>(sources.size());
+
+        for (int firstSource = 0; firstSource < sourceCount; firstSource += lanesPerBatch) {
+            const int batchSize = std::min(lanesPerBatch, sourceCount - firstSource);
+            detail::generateBitParallelBatch(dijkstraMaps, sources, firstSource, batchSize, walkable, directions);
+        }
+
+        return dijkstraMaps;
+    }
+
+    /**
+     * @brief Generate all channels of a multi-channel Dijkstra map in one traversal
+     *
+     * Runs one Dijkstra flood-fill for all channels at once over a bucket queue.
+     * Walkability is read once per tile, a queue entry expands every channel
+     * whose distance at that tile equals the entry's distance, and the
+     * per-channel update is a fixed-width, branch-free loop over the interleaved
+     * channel values that the compiler can vectorize.
+     *
+     * @param multiMap The map to populate with distances
+     * @param goals Goal positions per channel (distance 0 in that channel)
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     */
+    template<int Channels, typename WalkableFunc>
+    void generateMultiDijkstraMap(MultiDijkstraMap<Channels>& multiMap,
+                                  const std::array<CoordList, static_cast<std::size_t>(Channels)>& goals,
+                                  WalkableFunc isWalkable)
+    {
+        multiMap.clear();
+        const auto [width, height] = multiMap.getDimensions();
+
+        // Read walkability once for all channels
+        std::vector<char> walkable(static_cast<std::size_t>(width) * height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                walkable[static_cast<std::size_t>(y) * width + x] = isWalkable(x, y);
+            }
+        }
+
+        const auto& directions = detail::getDirections(multiMap.getDistanceType());
+        const auto& stepCosts = detail::getStepCosts(multiMap.getDistanceType());
+        const int directionCount = static_cast<int>(directions.size());
+
+        BucketQueue queue(*std::max_element(stepCosts.begin(), stepCosts.end()));
+        for (int channel = 0; channel < Channels; ++channel) {
+            for (const auto& [goalX, goalY] : goals[channel]) {
+                if (!multiMap.isWithinBounds(goalX, goalY) || !walkable[static_cast<std::size_t>(goalY) * width + goalX]) {
+                    continue;
+                }
+
+                multiMap.setDistance(channel, goalX, goalY, 0);
+                queue.push(0, goalY * width + goalX);
+            }
+        }
+
+        // Distance at which each tile was last expanded, to skip duplicate entries
+        std::vector<int> expandedAt(walkable.size(), -1);
+
+        while (!queue.empty()) {
+            const auto [currentDist, currentIndex] = queue.pop();
+            const int currentX = currentIndex % width;
+            const int currentY = currentIndex / width;
+
+            const int* current = multiMap.getTile(currentX, currentY);
+            const bool anySettled = std::find(current, current + Channels, currentDist) != current + Channels;
+            if (expandedAt[currentIndex] == currentDist || !anySettled) {
+                continue;
+            }
+            expandedAt[currentIndex] = currentDist;
+
+            for (int direction = 0; direction < directionCount; ++direction) {
+                const auto [dx, dy] = directions[direction];
+                const int neighborX = currentX + dx;
+                const int neighborY = currentY + dy;
+                const int neighborIndex = neighborY * width + neighborX;
+                if (!multiMap.isWithinBounds(neighborX, neighborY) || !walkable[neighborIndex]) {
+                    continue;
+                }
+
+                // Relax every channel settled at this distance; all improve to the same value
+                const int newDistance = currentDist + stepCosts[direction];
+                int* neighbor = multiMap.getTile(neighborX, neighborY);
+                bool improved = false;
+                for (int channel = 0; channel < Channels; ++channel) {
+                    const bool relax = current[channel] == currentDist && newDistance < neighbor[channel];
+                    neighbor[channel] = relax ? newDistance : neighbor[channel];
+                    improved |= relax;
+                }
+
+                if (improved) {
+                    queue.push(newDistance, neighborIndex);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Generate a Dijkstra map with a selectable generation engine
+     *
+     * EuclideanTransform writes true straight-line distances (rounded) instead of
+     * summed 4-directional steps. Obstacle-free maps use an exact separable
+     * transform. On maps with walls, tiles that see their nearest goal get the
+     * straight-line distance and the others the length of a path bending at
+     * wall corners; see detail::generateVisibilityEuclideanTransform. Maps whose
+     * distance type is not Euclidean use the FloodFill engine instead.
+     * ChamferSweep produces the same distances as
+     * FloodFill with linear row sweeps and no priority queue, which pays off on
+     * open maps and loses on winding mazes.
+     *
+     * @param dijkstraMap The map to populate with distances
+     * @param goals Vector of goal positions (distance 0)
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param engine Algorithm used to compute the distances
+     */
+    template<typename WalkableFunc>
+    void generateDijkstraMap(DijkstraMap& dijkstraMap,
+                             const CoordList& goals,
+                             WalkableFunc isWalkable,
+                             GenerationEngine engine)
+    {
+        const DistanceType distType = dijkstraMap.getDistanceType();
+        if (engine == GenerationEngine::ChamferSweep) {
+            detail::generateChamferSweep(dijkstraMap, goals, isWalkable);
+            return;
+        }
+        if (engine == GenerationEngine::FloodFill || distType != DistanceType::Euclidean) {
+            generateDijkstraMap(dijkstraMap, goals, isWalkable);
+            return;
+        }
+
+        const auto [width, height] = dijkstraMap.getDimensions();
+        const BitGrid walkable = buildWalkabilityGrid(width, height, isWalkable);
+
+        // Drop goals the flood fill would ignore
+        CoordList validGoals;
+        for (const auto& [goalX, goalY] : goals) {
+            if (walkable.get(goalX, goalY)) {
+                validGoals.emplace_back(goalX, goalY);
+            }
+        }
+
+        dijkstraMap.clear();
+        if (walkable.count() == width * height) {
+            detail::generateSeparableEuclideanTransform(dijkstraMap, validGoals);
+        } else {
+            detail::generateVisibilityEuclideanTransform(dijkstraMap, validGoals, walkable);
+        }
+    }
+
+    /**
+     * @brief Generate a Dijkstra map over per-tile movement costs
+     *
+     * Entering a tile costs its tile cost times the step cost of the distance
+     * type (1 per step, or 1000/1414 for Octile). Tiles with a negative cost are
+     * impassable. Path lengths that do not fit in an int leave their tile
+     * unreachable.
+     *
+     * @param dijkstraMap The map to populate with distances
+     * @param goals Vector of goal positions (distance 0)
+     * @param tileCost Function returning the cost to enter a tile: int(int x, int y)
+     */
+    template<typename CostFunc>
+    void generateWeightedDijkstraMap(DijkstraMap& dijkstraMap,
+                                     const CoordList& goals,
+                                     CostFunc tileCost)
+    {
+        dijkstraMap.clear();
+
+        auto isPassable = [&tileCost](int x, int y) {
+            return tileCost(x, y) >= 0;
+        };
+
+        PriorityQueue queue;
+        detail::initializeGoals(dijkstraMap, goals, isPassable, queue);
+
+        const auto& directions = detail::getDirections(dijkstraMap.getDistanceType());
+        const auto& stepCosts = detail::getStepCosts(dijkstraMap.getDistanceType());
+        const int directionCount = static_cast<int>(directions.size());
+
+        while (!queue.empty()) {
+            const auto [currentDist, currentX, currentY] = queue.top();
+            queue.pop();
+
+            // Skip if we've already found a better path to this tile
+            if (currentDist > dijkstraMap.getDistance(currentX, currentY)) {
+                continue;
+            }
+
+            for (int direction = 0; direction < directionCount; ++direction) {
+                const auto [dx, dy] = directions[direction];
+                const int neighborX = currentX + dx;
+                const int neighborY = currentY + dy;
+                if (!dijkstraMap.isWithinBounds(neighborX, neighborY)) {
+                    continue;
+                }
+
+                const int cost = tileCost(neighborX, neighborY);
+                if (cost < 0) {
+                    continue;
+                }
+
+                const std::int64_t newDistance = currentDist + static_cast<std::int64_t>(stepCosts[direction]) * cost;
+                if (newDistance < dijkstraMap.getDistance(neighborX, neighborY)) {
+                    dijkstraMap.setDistance(neighborX, neighborY, static_cast<int>(newDistance));
+                    queue.push({static_cast<int>(newDistance), neighborX, neighborY});
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Generate a weighted Dijkstra map by fast sweeping (Gauss-Seidel relaxation)
+     *
+     * Each iteration sweeps the map in the four diagonal orderings, updating every
+     * tile in place from its neighbors. On smooth cost fields distances settle in
+     * a handful of iterations. An iteration that changes nothing proves the map
+     * equals generateWeightedDijkstraMap; if the iteration cap is hit first, every
+     * distance is still the length of a real path but may not be the shortest.
+     * Path lengths that do not fit in an int leave their tile unreachable, as
+     * with generateWeightedDijkstraMap.
+     *
+     * @param dijkstraMap The map to populate with distances
+     * @param goals Vector of goal positions (distance 0)
+     * @param tileCost Function returning the cost to enter a tile: int(int x, int y)
+     * @param options Iteration cap
+     * @return Number of iterations run and whether the distances are exact
+     */
+    template<typename CostFunc>
+    SweepResult generateWeightedDijkstraMapBySweeping(DijkstraMap& dijkstraMap,
+                                                      const CoordList& goals,
+                                                      CostFunc tileCost,
+                                                      SweepOptions options = {})
+    {
+        // Sums are taken in 64 bits and saturate here, so unreached neighbors never lower a tile
+        constexpr int infinity = DijkstraMap::UNREACHABLE;
+
+        const auto [width, height] = dijkstraMap.getDimensions();
+        const DistanceType distType = dijkstraMap.getDistanceType();
+        const auto& stepCosts = detail::getStepCosts(distType);
+        const int straightCost = stepCosts[0];
+        const bool diagonal = detail::usesDiagonalMovement(distType);
+        const int diagonalCost = diagonal ? stepCosts[4] : 0;
+
+        // Cache tile costs, row-major
+        std::vector<int> entryCosts(static_cast<std::size_t>(width) * height);
+        for (int y = 0; y < height; ++y) {
+            int* row = dijkstraMap.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                entryCosts[static_cast<std::size_t>(y) * width + x] = tileCost(x, y);
+                row[x] = infinity;
+            }
+        }
+
+        for (const auto& [goalX, goalY] : goals) {
+            if (dijkstraMap.isWithinBounds(goalX, goalY)
+                && entryCosts[static_cast<std::size_t>(goalY) * width + goalX] >= 0) {
+                dijkstraMap.getRow(goalY)[goalX] = 0;
+            }
+        }
+
+        // Stands in for the rows above the first and below the last row
+        const std::vector<int> outsideRow(width, infinity);
+
+        // Lower every passable tile of a row, in sweep order, to its best neighbor plus its entry cost
+        auto relaxRow = [&, width = width, height = height](int y, int stepX) {
+            int* row = dijkstraMap.getRow(y);
+            const int* above = (y > 0) ? dijkstraMap.getRow(y - 1) : outsideRow.data();
+            const int* below = (y + 1 < height) ? dijkstraMap.getRow(y + 1) : outsideRow.data();
+            const int* costs = entryCosts.data() + static_cast<std::size_t>(y) * width;
+
+            bool changed = false;
+            for (int column = 0; column < width; ++column) {
+                const int x = (stepX > 0) ? column : width - 1 - column;
+                const int entryCost = costs[x];
+                if (entryCost < 0) {
+                    continue;
+                }
+
+                const int left = (x > 0) ? x - 1 : -1;
+                const int right = (x + 1 < width) ? x + 1 : -1;
+                auto at = [](const int* values, int index) {
+                    return (index >= 0) ? values[index] : infinity;
+                };
+
+                const int straight = std::min(std::min(at(row, left), at(row, right)), std::min(above[x], below[x]));
+                std::int64_t best = straight + static_cast<std::int64_t>(straightCost) * entryCost;
+                if (diagonal) {
+                    const int diagonalNeighbor = std::min(std::min(at(above, left), at(above, right)),
+                                                          std::min(at(below, left), at(below, right)));
+                    best = std::min(best, diagonalNeighbor + static_cast<std::int64_t>(diagonalCost) * entryCost);
+                }
+
+                if (best < row[x]) {
+                    row[x] = static_cast<int>(best);
+                    changed = true;
+                }
+            }
+            return changed;
+        };
+
+        // Sweep orderings as (x step, y step)
+        constexpr std::array<std::tuple<int, int>, 4> orderings = {{{1, 1}, {-1, 1}, {-1, -1}, {1, -1}}};
+
+        SweepResult result{0, false};
+        while (result.iterations < options.maxIterations) {
+            ++result.iterations;
+            bool changed = false;
+
+            for (const auto& [stepX, stepY] : orderings) {
+                for (int row = 0; row < height; ++row) {
+                    changed |= relaxRow((stepY > 0) ? row : height - 1 - row, stepX);
+                }
+            }
+
+            if (!changed) {
+                result.converged = true;
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Decompose the walkable tiles into wall-free rectangles
+     *
+     * Greedy: the first uncovered walkable tile in row-major order starts a
+     * rectangle that is grown right as far as possible, then down while every
+     * tile of the next row is walkable and uncovered.
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @return Decomposition covering every walkable tile exactly once
+     */
+    template<typename WalkableFunc>
+    RectangleDecomposition decomposeIntoRectangles(int width, int height, WalkableFunc isWalkable)
+    {
+        RectangleDecomposition decomposition(width, height);
+        const BitGrid walkable = buildWalkabilityGrid(width, height, isWalkable);
+
+        auto isFree = [&](int x, int y) {
+            return walkable.get(x, y) && decomposition.getRectangleId(x, y) == RectangleDecomposition::NO_RECTANGLE;
+        };
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (!isFree(x, y)) {
+                    continue;
+                }
+
+                int xEnd = x + 1;
+                while (isFree(xEnd, y)) {
+                    ++xEnd;
+                }
+
+                int yEnd = y + 1;
+                while (yEnd < height) {
+                    int column = x;
+                    while (column < xEnd && isFree(column, yEnd)) {
+                        ++column;
+                    }
+                    if (column < xEnd) {
+                        break;
+                    }
+                    ++yEnd;
+                }
+
+                decomposition.addRectangle({x, y, xEnd - x, yEnd - y});
+                x = xEnd - 1;
+            }
+        }
+
+        return decomposition;
+    }
+
+    /**
+     * @brief Generate a Dijkstra map by propagating across rectangle boundaries
+     *
+     * Inside a wall-free rectangle every distance follows from the values on its
+     * border, so rectangles rather than tiles go through the priority queue,
+     * keyed by the smallest value entering them. Popping a rectangle fills it
+     * with one forward and one backward row sweep, then pushes its border values
+     * into adjacent rectangles, which are queued again whenever one of their
+     * tiles improves. The result equals generateDijkstraMap for every distance
+     * type, with tiles outside all rectangles treated as walls.
+     *
+     * @param dijkstraMap The map to populate with distances
+     * @param decomposition Rectangles covering the walkable tiles, same dimensions as the map
+     * @param goals Vector of goal positions (distance 0); goals outside all rectangles are ignored
+     */
+    inline void generateDijkstraMapFromRectangles(DijkstraMap& dijkstraMap,
+                                                  const RectangleDecomposition& decomposition,
+                                                  const CoordList& goals)
+    {
+        // Small enough that infinity plus a step cost never overflows
+        constexpr int infinity = std::numeric_limits<int>::max() / 4;
+
+        const auto [width, height] = dijkstraMap.getDimensions();
+        for (int y = 0; y < height; ++y) {
+            std::fill(dijkstraMap.getRow(y), dijkstraMap.getRow(y) + width, infinity);
+        }
+
+        const DistanceType distType = dijkstraMap.getDistanceType();
+        const auto& directions = detail::getDirections(distType);
+        const auto& stepCosts = detail::getStepCosts(distType);
+        const int directionCount = static_cast<int>(directions.size());
+        const int straightCost = stepCosts[0];
+        const int diagonalCost = detail::usesDiagonalMovement(distType) ? stepCosts[4] : 0;
+
+        // Queue of (smallest entering distance, rectangle ID); stale entries are skipped
+        using RectangleEntry = std::tuple<int, int>;
+        std::priority_queue<RectangleEntry, std::vector<RectangleEntry>, std::greater<RectangleEntry>> queue;
+        std::vector<int> pendingKeys(decomposition.getRectangleCount(), DijkstraMap::UNREACHABLE);
+
+        auto schedule = [&](int rectangleId, int key) {
+            if (key < pendingKeys[rectangleId]) {
+                pendingKeys[rectangleId] = key;
+                queue.push({key, rectangleId});
+            }
+        };
+
+        for (const auto& [goalX, goalY] : goals) {
+            const int rectangleId = decomposition.getRectangleId(goalX, goalY);
+            if (rectangleId != RectangleDecomposition::NO_RECTANGLE) {
+                dijkstraMap.setDistance(goalX, goalY, 0);
+                schedule(rectangleId, 0);
+            }
+        }
+
+        // Rectangles are wall-free, so row sweeps need no entry penalty
+        const std::vector<int> noPenalty(width, 0);
+
+        // Push the value of a border tile into neighbors in other rectangles
+        auto pushAcross = [&](int x, int y, int rectangleId) {
+            const int distance = dijkstraMap.getRow(y)[x];
+            if (distance >= infinity) {
+                return;
+            }
+
+            for (int direction = 0; direction < directionCount; ++direction) {
+                const auto [dx, dy] = directions[direction];
+                const int neighborId = decomposition.getRectangleId(x + dx, y + dy);
+                if (neighborId == RectangleDecomposition::NO_RECTANGLE || neighborId == rectangleId) {
+                    continue;
+                }
+
+                const int newDistance = distance + stepCosts[direction];
+                int& neighbor = dijkstraMap.getRow(y + dy)[x + dx];
+                if (newDistance < neighbor) {
+                    neighbor = newDistance;
+                    schedule(neighborId, newDistance);
+                }
+            }
+        };
+
+        while (!queue.empty()) {
+            const auto [key, rectangleId] = queue.top();
+            queue.pop();
+
+            if (key != pendingKeys[rectangleId]) {
+                continue;
+            }
+            pendingKeys[rectangleId] = DijkstraMap::UNREACHABLE;
+
+            const RectangleDecomposition::Rectangle& rectangle = decomposition.getRectangle(rectangleId);
+            const int lastY = rectangle.y + rectangle.height - 1;
+            const int lastX = rectangle.x + rectangle.width - 1;
+
+            // Fill the interior from its current values
+            for (int y = rectangle.y; y <= lastY; ++y) {
+                int* row = dijkstraMap.getRow(y) + rectangle.x;
+                if (y > rectangle.y) {
+                    detail::relaxSweepRowVertically(row, dijkstraMap.getRow(y - 1) + rectangle.x, noPenalty.data(),
+                                                    rectangle.width, straightCost, diagonalCost);
+                }
+                detail::relaxSweepRowHorizontally(row, noPenalty.data(), rectangle.width, straightCost);
+            }
+            for (int y = lastY; y >= rectangle.y; --y) {
+                int* row = dijkstraMap.getRow(y) + rectangle.x;
+                if (y < lastY) {
+                    detail::relaxSweepRowVertically(row, dijkstraMap.getRow(y + 1) + rectangle.x, noPenalty.data(),
+                                                    rectangle.width, straightCost, diagonalCost);
+                }
+                detail::relaxSweepRowHorizontally(row, noPenalty.data(), rectangle.width, straightCost);
+            }
+
+            // Propagate from the border
+            for (int x = rectangle.x; x <= lastX; ++x) {
+                pushAcross(x, rectangle.y, rectangleId);
+                if (lastY > rectangle.y) {
+                    pushAcross(x, lastY, rectangleId);
+                }
+            }
+            for (int y = rectangle.y + 1; y < lastY; ++y) {
+                pushAcross(rectangle.x, y, rectangleId);
+                if (lastX > rectangle.x) {
+                    pushAcross(lastX, y, rectangleId);
+                }
+            }
+        }
+
+        for (int y = 0; y < height; ++y) {
+            int* row = dijkstraMap.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                row[x] = (row[x] >= infinity) ? DijkstraMap::UNREACHABLE : row[x];
+            }
+        }
+    }
+
+    /**
+     * @brief Build a corridor graph of the walkable tiles
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type selecting connectivity and step costs
+     * @return Graph with a node per non-corridor tile and a chain per corridor
+     */
+    template<typename WalkableFunc>
+    CorridorGraph buildCorridorGraph(int width,
+                                     int height,
+                                     WalkableFunc isWalkable,
+                                     DistanceType distType = DistanceType::Euclidean)
+    {
+        CorridorGraph graph(width, height, distType);
+        const auto& directions = detail::getDirections(distType);
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (isWalkable(x, y) && detail::countWalkableNeighbors(x, y, width, height, directions, isWalkable) != 2) {
+                    graph.addNode(x, y);
+                }
+            }
+        }
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                detail::traceLooseCorridorTile(graph, x, y, isWalkable);
+            }
+        }
+
+        return graph;
+    }
+
+    /**
+     * @brief Update a corridor graph after the walkability of one tile changed
+     *
+     * Only the tile and its neighbors can change between node and corridor, so
+     * just the nodes and chains touching them are removed and traced again.
+     *
+     * @param graph Graph built with buildCorridorGraph
+     * @param x X coordinate of the changed tile
+     * @param y Y coordinate of the changed tile
+     * @param isWalkable Walkability function reflecting the change: bool(int x, int y)
+     */
+    template<typename WalkableFunc>
+    void updateCorridorGraph(CorridorGraph& graph, int x, int y, WalkableFunc isWalkable)
+    {
+        if (!graph.isWithinBounds(x, y)) {
+            return;
+        }
+
+        const auto [width, height] = graph.getDimensions();
+        const auto& directions = detail::getDirections(graph.getDistanceType());
+
+        CoordList affectedTiles = {{x, y}};
+        for (const auto& [dx, dy] : directions) {
+            if (graph.isWithinBounds(x + dx, y + dy)) {
+                affectedTiles.emplace_back(x + dx, y + dy);
+            }
+        }
+
+        // Tiles whose chain or node is removed and which must be traced again
+        CoordList looseTiles = affectedTiles;
+        auto dissolveChain = [&](int chainId) {
+            for (int tile : graph.getChain(chainId).tiles) {
+                looseTiles.emplace_back(tile % width, tile / width);
+            }
+            graph.removeChain(chainId);
+        };
+
+        for (const auto& [tileX, tileY] : affectedTiles) {
+            const int chainId = graph.getChainId(tileX, tileY);
+            if (chainId != CorridorGraph::NO_CHAIN) {
+                dissolveChain(chainId);
+            }
+
+            const int nodeId = graph.getNodeId(tileX, tileY);
+            if (nodeId != CorridorGraph::NO_NODE) {
+                while (!graph.getIncidentChains(nodeId).empty()) {
+                    dissolveChain(graph.getIncidentChains(nodeId).back());
+                }
+                graph.removeNode(nodeId);
+            }
+        }
+
+        for (const auto& [tileX, tileY] : affectedTiles) {
+            if (isWalkable(tileX, tileY)
+                && detail::countWalkableNeighbors(tileX, tileY, width, height, directions, isWalkable) != 2) {
+                graph.addNode(tileX, tileY);
+            }
+        }
+
+        for (const auto& [tileX, tileY] : looseTiles) {
+            detail::traceLooseCorridorTile(graph, tileX, tileY, isWalkable);
+        }
+    }
+
+    /**
+     * @brief Generate a Dijkstra map by running Dijkstra on a corridor graph
+     *
+     * Only nodes go through the priority queue; corridor tiles are filled
+     * afterwards from the distances of their chain's two end nodes. Goals on
+     * corridor tiles seed both end nodes of their chain. The result equals
+     * generateDijkstraMap for the graph's walkability.
+     *
+     * @param dijkstraMap The map to populate, with the graph's dimensions and distance type
+     * @param graph Corridor graph of the walkable tiles
+     * @param goals Vector of goal positions (distance 0); non-walkable goals are ignored
+     */
+    inline void generateDijkstraMapFromCorridorGraph(DijkstraMap& dijkstraMap,
+                                                     const CorridorGraph& graph,
+                                                     const CoordList& goals)
+    {
+        dijkstraMap.clear();
+
+        const auto [width, height] = graph.getDimensions();
+        const auto& directions = detail::getDirections(graph.getDistanceType());
+        const auto& stepCosts = detail::getStepCosts(graph.getDistanceType());
+        const int directionCount = static_cast<int>(directions.size());
+
+        std::vector<int> nodeDistances(graph.getNodeCount(), DijkstraMap::UNREACHABLE);
+        std::priority_queue<std::tuple<int, int>, std::vector<std::tuple<int, int>>,
+                            std::greater<std::tuple<int, int>>> queue;
+
+        auto relaxNode = [&](int nodeId, int distance) {
+            if (distance < nodeDistances[nodeId]) {
+                nodeDistances[nodeId] = distance;
+                queue.push({distance, nodeId});
+            }
+        };
+
+        // Goals on corridor tiles as (chain ID, offset), sorted by chain
+        std::vector<std::tuple<int, int>> chainGoals;
+        for (const auto& [goalX, goalY] : goals) {
+            const int nodeId = graph.getNodeId(goalX, goalY);
+            if (nodeId != CorridorGraph::NO_NODE) {
+                relaxNode(nodeId, 0);
+                continue;
+            }
+
+            const int chainId = graph.getChainId(goalX, goalY);
+            if (chainId == CorridorGraph::NO_CHAIN) {
+                continue;
+            }
+
+            const CorridorGraph::Chain& chain = graph.getChain(chainId);
+            const auto position = std::find(chain.tiles.begin(), chain.tiles.end(), goalY * width + goalX);
+            const int offset = chain.offsets[position - chain.tiles.begin()];
+            chainGoals.emplace_back(chainId, offset);
+            relaxNode(chain.firstNode, offset);
+            relaxNode(chain.lastNode, chain.length - offset);
+        }
+        std::sort(chainGoals.begin(), chainGoals.end());
+
+        while (!queue.empty()) {
+            const auto [currentDist, nodeId] = queue.top();
+            queue.pop();
+
+            if (currentDist > nodeDistances[nodeId]) {
+                continue;
+            }
+
+            for (int chainId : graph.getIncidentChains(nodeId)) {
+                const CorridorGraph::Chain& chain = graph.getChain(chainId);
+                const int otherNode = (chain.firstNode == nodeId) ? chain.lastNode : chain.firstNode;
+                relaxNode(otherNode, currentDist + chain.length);
+            }
+
+            // Adjacent nodes are joined directly, without a chain
+            const auto [nodeX, nodeY] = graph.getNode(nodeId);
+            for (int direction = 0; direction < directionCount; ++direction) {
+                const auto [dx, dy] = directions[direction];
+                const int neighborNode = graph.getNodeId(nodeX + dx, nodeY + dy);
+                if (neighborNode != CorridorGraph::NO_NODE) {
+                    relaxNode(neighborNode, currentDist + stepCosts[direction]);
+                }
+            }
+        }
+
+        for (int nodeId = 0; nodeId < graph.getNodeCount(); ++nodeId) {
+            if (graph.isNodeActive(nodeId)) {
+                const auto [nodeX, nodeY] = graph.getNode(nodeId);
+                dijkstraMap.setDistance(nodeX, nodeY, nodeDistances[nodeId]);
+            }
+        }
+
+        // Fill every chain from its end nodes and the goals on it
+        auto addDistance = [](int distance, int cost) {
+            return (distance == DijkstraMap::UNREACHABLE) ? DijkstraMap::UNREACHABLE : distance + cost;
+        };
+
+        for (int chainId = 0; chainId < graph.getChainCount(); ++chainId) {
+            if (!graph.isChainActive(chainId)) {
+                continue;
+            }
+
+            const CorridorGraph::Chain& chain = graph.getChain(chainId);
+            const int firstDistance = nodeDistances[chain.firstNode];
+            const int lastDistance = nodeDistances[chain.lastNode];
+            const auto goalsBegin = std::lower_bound(chainGoals.begin(), chainGoals.end(),
+                                                     std::make_tuple(chainId, 0));
+            const auto goalsEnd = std::lower_bound(goalsBegin, chainGoals.end(), std::make_tuple(chainId + 1, 0));
+
+            const int tileCount = static_cast<int>(chain.tiles.size());
+            for (int position = 0; position < tileCount; ++position) {
+                const int offset = chain.offsets[position];
+                int distance = std::min(addDistance(firstDistance, offset),
+                                        addDistance(lastDistance, chain.length - offset));
+                for (auto goal = goalsBegin; goal != goalsEnd; ++goal) {
+                    const auto [goalChain, goalOffset] = *goal;
+                    distance = std::min(distance, std::abs(offset - goalOffset));
+                }
+
+                const int tile = chain.tiles[position];
+                dijkstraMap.setDistance(tile % width, tile / width, distance);
+            }
+        }
+    }
+
+    /**
+     * @brief Build the chunk hierarchy of a map
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param chunkSize Width and height of a chunk in tiles; values below 1 are treated as 1
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type selecting connectivity and step costs
+     * @return Hierarchy with crossings and entrance distance tables for every chunk
+     */
+    template<typename WalkableFunc>
+    ChunkHierarchy buildChunkHierarchy(int width,
+                                       int height,
+                                       int chunkSize,
+                                       WalkableFunc isWalkable,
+                                       DistanceType distType = DistanceType::Euclidean)
+    {
+        ChunkHierarchy hierarchy(width, height, chunkSize, distType);
+        const auto [chunksX, chunksY] = hierarchy.getChunkCounts();
+
+        for (int chunkY = 0; chunkY < chunksY; ++chunkY) {
+            for (int chunkX = 0; chunkX < chunksX; ++chunkX) {
+                detail::updateChunkCrossings(hierarchy, chunkX, chunkY, isWalkable);
+            }
+        }
+        for (int chunkY = 0; chunkY < chunksY; ++chunkY) {
+            for (int chunkX = 0; chunkX < chunksX; ++chunkX) {
+                detail::updateChunkDistanceTable(hierarchy, chunkX, chunkY, isWalkable);
+            }
+        }
+
+        return hierarchy;
+    }
+
+    /**
+     * @brief Update a chunk hierarchy after walkability changed inside one chunk
+     *
+     * Recomputes the crossings on the chunk's borders and corners and the
+     * entrance distance tables of the chunk and its eight neighbors.
+     *
+     * @param hierarchy Hierarchy built with buildChunkHierarchy
+     * @param chunkX Column of the changed chunk
+     * @param chunkY Row of the changed chunk
+     * @param isWalkable Walkability function reflecting the change: bool(int x, int y)
+     */
+    template<typename WalkableFunc>
+    void updateChunkHierarchy(ChunkHierarchy& hierarchy, int chunkX, int chunkY, WalkableFunc isWalkable)
+    {
+        if (!hierarchy.isChunkWithinBounds(chunkX, chunkY)) {
+            return;
+        }
+
+        // Crossings are stored by the chunk west or north of them; corner
+        // crossings also depend on the tiles of the chunks beside the corner
+        for (int dy = -1; dy <= 0; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (hierarchy.isChunkWithinBounds(chunkX + dx, chunkY + dy)) {
+                    detail::updateChunkCrossings(hierarchy, chunkX + dx, chunkY + dy, isWalkable);
+                }
+            }
+        }
+
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (hierarchy.isChunkWithinBounds(chunkX + dx, chunkY + dy)) {
+                    detail::updateChunkDistanceTable(hierarchy, chunkX + dx, chunkY + dy, isWalkable);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Generate a hierarchical Dijkstra map by running Dijkstra on the chunk entrances
+     *
+     * Goals reach the entrances of their own chunks by an in-chunk flood fill;
+     * from there Dijkstra runs over the abstract graph of entrances, joined by
+     * the in-chunk distance tables and the border crossings. No tile distances
+     * are computed until a chunk is refined. Paths are restricted to pass
+     * through entrances, so distances can exceed generateDijkstraMap's.
+     *
+     * @param hierarchy Chunk hierarchy of the map
+     * @param goals Vector of goal positions (distance 0)
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @return Map holding every entrance distance and no refined chunks
+     */
+    template<typename WalkableFunc>
+    HierarchicalDijkstraMap generateHierarchicalDijkstraMap(const ChunkHierarchy& hierarchy,
+                                                            const CoordList& goals,
+                                                            WalkableFunc isWalkable)
+    {
+        const auto [width, height] = hierarchy.getDimensions();
+        const auto [chunksX, chunksY] = hierarchy.getChunkCounts();
+        const int chunkSize = hierarchy.getChunkSize();
+        const int chunkCount = chunksX * chunksY;
+        const auto& stepCosts = detail::getStepCosts(hierarchy.getDistanceType());
+
+        HierarchicalDijkstraMap hierarchicalMap(width, height, chunkSize);
+        hierarchicalMap.setGoals(goals);
+
+        // Abstract nodes: the entrances of all chunks, numbered chunk by chunk
+        std::vector<std::array<int, ChunkHierarchy::ENTRANCE_GROUP_COUNT + 1>> entranceOffsets(chunkCount);
+        std::vector<int> firstNodes(chunkCount + 1, 0);
+        for (int chunkY = 0; chunkY < chunksY; ++chunkY) {
+            for (int chunkX = 0; chunkX < chunksX; ++chunkX) {
+                const int chunk = hierarchy.getChunkIndex(chunkX, chunkY);
+                entranceOffsets[chunk] = hierarchy.getEntranceOffsets(chunkX, chunkY);
+                firstNodes[chunk + 1] = firstNodes[chunk] + entranceOffsets[chunk][ChunkHierarchy::ENTRANCE_GROUP_COUNT];
+            }
+        }
+        const int nodeCount = firstNodes[chunkCount];
+
+        // Partner node across the crossing of every entrance, and the cost of the step
+        std::vector<int> nodeChunks(nodeCount);
+        std::vector<int> partners(nodeCount, -1);
+        std::vector<int> crossingCosts(nodeCount, 0);
+        for (int chunkY = 0; chunkY < chunksY; ++chunkY) {
+            for (int chunkX = 0; chunkX < chunksX; ++chunkX) {
+                const int chunk = hierarchy.getChunkIndex(chunkX, chunkY);
+                std::fill(nodeChunks.begin() + firstNodes[chunk], nodeChunks.begin() + firstNodes[chunk + 1], chunk);
+
+                // Crossings stored by this chunk as (group, chunk across); the
+                // other chunk lists them in the group just before
+                const std::array<std::tuple<int, int, int, const std::vector<ChunkHierarchy::Crossing>*>, 4> borders = {{
+                    {1, chunkX, chunkY + 1, &hierarchy.getSouthCrossings(chunkX, chunkY)},
+                    {3, chunkX + 1, chunkY, &hierarchy.getEastCrossings(chunkX, chunkY)},
+                    {5, chunkX + 1, chunkY + 1, &hierarchy.getSouthEastCrossings(chunkX, chunkY)},
+                    {7, chunkX - 1, chunkY + 1, &hierarchy.getSouthWestCrossings(chunkX, chunkY)}
+                }};
+                for (const auto& [group, otherChunkX, otherChunkY, crossings] : borders) {
+                    for (int crossing = 0; crossing < static_cast<int>(crossings->size()); ++crossing) {
+                        const auto& [x, y, otherX, otherY] = (*crossings)[crossing];
+                        const int otherChunk = hierarchy.getChunkIndex(otherChunkX, otherChunkY);
+                        const int node = firstNodes[chunk] + entranceOffsets[chunk][group] + crossing;
+                        const int partner = firstNodes[otherChunk] + entranceOffsets[otherChunk][group - 1] + crossing;
+                        const int cost = (x != otherX && y != otherY) ? stepCosts[4] : stepCosts[0];
+                        partners[node] = partner;
+                        partners[partner] = node;
+                        crossingCosts[node] = cost;
+                        crossingCosts[partner] = cost;
+                    }
+                }
+            }
+        }
+
+        std::vector<int> nodeDistances(nodeCount, DijkstraMap::UNREACHABLE);
+        std::priority_queue<std::tuple<int, int>, std::vector<std::tuple<int, int>>,
+                            std::greater<std::tuple<int, int>>> queue;
+
+        auto relaxNode = [&](int node, int distance) {
+            if (distance < nodeDistances[node]) {
+                nodeDistances[node] = distance;
+                queue.push({distance, node});
+            }
+        };
+
+        // Seed the entrances of every chunk holding goals
+        std::vector<std::vector<QueueEntry>> chunkGoals(chunkCount);
+        for (const auto& [goalX, goalY] : goals) {
+            if (goalX >= 0 && goalX < width && goalY >= 0 && goalY < height) {
+                chunkGoals[hierarchy.getChunkIndex(goalX / chunkSize, goalY / chunkSize)].emplace_back(0, goalX, goalY);
+            }
+        }
+        for (int chunk = 0; chunk < chunkCount; ++chunk) {
+            if (chunkGoals[chunk].empty()) {
+                continue;
+            }
+
+            const int chunkX = chunk % chunksX;
+            const int chunkY = chunk / chunksX;
+            const auto [x0, y0, chunkWidth, chunkHeight] = hierarchy.getChunkBounds(chunkX, chunkY);
+            const DijkstraMap local = detail::fillChunk(hierarchy, chunkX, chunkY, chunkGoals[chunk], isWalkable);
+            const auto entrances = hierarchy.getEntrances(chunkX, chunkY);
+            for (int entrance = 0; entrance < static_cast<int>(entrances.size()); ++entrance) {
+                const auto [entranceX, entranceY] = entrances[entrance];
+                const int distance = local.getDistance(entranceX - x0, entranceY - y0);
+                if (distance != DijkstraMap::UNREACHABLE) {
+                    relaxNode(firstNodes[chunk] + entrance, distance);
+                }
+            }
+        }
+
+        while (!queue.empty()) {
+            const auto [currentDist, node] = queue.top();
+            queue.pop();
+
+            if (currentDist > nodeDistances[node]) {
+                continue;
+            }
+
+            relaxNode(partners[node], currentDist + crossingCosts[node]);
+
+            const int chunk = nodeChunks[node];
+            const int firstNode = firstNodes[chunk];
+            const int entranceCount = firstNodes[chunk + 1] - firstNode;
+            const std::vector<int>& table = hierarchy.getDistanceTable(chunk % chunksX, chunk / chunksX);
+            const int* row = table.data() + static_cast<std::size_t>(node - firstNode) * entranceCount;
+            for (int entrance = 0; entrance < entranceCount; ++entrance) {
+                if (row[entrance] != DijkstraMap::UNREACHABLE) {
+                    relaxNode(firstNode + entrance, currentDist + row[entrance]);
+                }
+            }
+        }
+
+        for (int chunk = 0; chunk < chunkCount; ++chunk) {
+            hierarchicalMap.setEntranceDistances(chunk % chunksX, chunk / chunksX,
+                std::vector<int>(nodeDistances.begin() + firstNodes[chunk], nodeDistances.begin() + firstNodes[chunk + 1]));
+        }
+
+        return hierarchicalMap;
+    }
+
+    /**
+     * @brief Compute the tile distances of one chunk of a hierarchical Dijkstra map
+     *
+     * Flood fills the chunk from its entrance distances and the goals inside it.
+     *
+     * @param hierarchicalMap Map generated with generateHierarchicalDijkstraMap
+     * @param hierarchy Chunk hierarchy the map was generated from
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     */
+    template<typename WalkableFunc>
+    void refineChunk(HierarchicalDijkstraMap& hierarchicalMap,
+                     const ChunkHierarchy& hierarchy,
+                     int chunkX,
+                     int chunkY,
+                     WalkableFunc isWalkable)
+    {
+        if (!hierarchy.isChunkWithinBounds(chunkX, chunkY)) {
+            return;
+        }
+
+        std::vector<QueueEntry> seeds;
+        const auto entrances = hierarchy.getEntrances(chunkX, chunkY);
+        const std::vector<int>& entranceDistances = hierarchicalMap.getEntranceDistances(chunkX, chunkY);
+        for (int entrance = 0; entrance < static_cast<int>(entrances.size()); ++entrance) {
+            const auto [entranceX, entranceY] = entrances[entrance];
+            if (entranceDistances[entrance] != DijkstraMap::UNREACHABLE) {
+                seeds.emplace_back(entranceDistances[entrance], entranceX, entranceY);
+            }
+        }
+        for (const auto& [goalX, goalY] : hierarchicalMap.getGoals()) {
+            seeds.emplace_back(0, goalX, goalY);
+        }
+
+        const DijkstraMap local = detail::fillChunk(hierarchy, chunkX, chunkY, seeds, isWalkable);
+        const auto [localWidth, localHeight] = local.getDimensions();
+        const int chunkSize = hierarchy.getChunkSize();
+
+        std::vector<int> distances(static_cast<std::size_t>(chunkSize) * chunkSize, DijkstraMap::UNREACHABLE);
+        for (int y = 0; y < localHeight; ++y) {
+            std::copy(local.getRow(y), local.getRow(y) + localWidth,
+                      distances.begin() + static_cast<std::ptrdiff_t>(y) * chunkSize);
+        }
+        hierarchicalMap.setChunkDistances(chunkX, chunkY, std::move(distances));
+    }
+
+    /**
+     * @brief Get a tile distance, refining its chunk first if needed
+     *
+     * @param hierarchicalMap Map generated with generateHierarchicalDijkstraMap
+     * @param hierarchy Chunk hierarchy the map was generated from
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @return Distance value, or UNREACHABLE if unreachable or out of bounds
+     */
+    template<typename WalkableFunc>
+    int getHierarchicalDistance(HierarchicalDijkstraMap& hierarchicalMap,
+                                const ChunkHierarchy& hierarchy,
+                                int x,
+                                int y,
+                                WalkableFunc isWalkable)
+    {
+        if (!hierarchicalMap.isWithinBounds(x, y)) {
+            return DijkstraMap::UNREACHABLE;
+        }
+
+        const int chunkSize = hierarchy.getChunkSize();
+        if (!hierarchicalMap.isChunkRefined(x / chunkSize, y / chunkSize)) {
+            refineChunk(hierarchicalMap, hierarchy, x / chunkSize, y / chunkSize, isWalkable);
+        }
+        return hierarchicalMap.getDistance(x, y);
+    }
+
+    /**
+     * @brief Get the distance between two tiles without generating a whole map
+     *
+     * Runs A* guided by DijkstraMap::calculateDistance for the distance type,
+     * which never overestimates the travel distance, so the result equals
+     * the value generateDijkstraMap would store for start with goal as its
+     * only goal. Reuse the workspace across queries to avoid reallocating.
+     *
+     * @param workspace Scratch storage sized to the map
+     * @param start Start position
+     * @param goal Goal position
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @return Distance value, or UNREACHABLE if no path exists or an endpoint is blocked
+     */
+    template<typename WalkableFunc>
+    int queryDistance(SearchWorkspace& workspace,
+                      const Coord& start,
+                      const Coord& goal,
+                      WalkableFunc isWalkable,
+                      DistanceType distType = DistanceType::Euclidean)
+    {
+        const DijkstraMap metric(0, 0, distType);
+        const auto [goalX, goalY] = goal;
+
+        return detail::searchPath(workspace, start, goal, isWalkable, distType, [&](int x, int y) {
+            return metric.calculateDistance(x, y, goalX, goalY);
+        });
+    }
+
+    /**
+     * @brief Find a shortest path between two tiles
+     *
+     * Same search as queryDistance; the path follows the movement directions
+     * of the distance type.
+     *
+     * @param workspace Scratch storage sized to the map
+     * @param start Start position
+     * @param goal Goal position
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @return Positions from start to goal, both included; empty if no path exists
+     */
+    template<typename WalkableFunc>
+    CoordList findPath(SearchWorkspace& workspace,
+                       const Coord& start,
+                       const Coord& goal,
+                       WalkableFunc isWalkable,
+                       DistanceType distType = DistanceType::Euclidean)
+    {
+        if (queryDistance(workspace, start, goal, isWalkable, distType) == DijkstraMap::UNREACHABLE) {
+            return {};
+        }
+        return detail::reconstructPath(workspace, goal);
+    }
+
+    /**
+     * @brief Pick landmarks by farthest-point selection and store their distance maps
+     *
+     * The first landmark is the tile farthest from the first walkable tile;
+     * every next one is the tile farthest from all landmarks chosen so far.
+     * Tiles no landmark reaches count as farthest, so separate regions get
+     * landmarks of their own. Landmarks on the outskirts give the tightest bounds.
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param landmarkCount Maximum number of landmarks
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @return Landmark index; fewer landmarks if every tile is already a landmark
+     */
+    template<typename WalkableFunc>
+    LandmarkIndex buildLandmarkIndex(int width,
+                                     int height,
+                                     int landmarkCount,
+                                     WalkableFunc isWalkable,
+                                     DistanceType distType = DistanceType::Euclidean)
+    {
+        LandmarkIndex index(width, height, distType);
+        DijkstraMap landmarkMap(width, height, distType);
+
+        // Distance from each walkable tile to its nearest landmark; walls never get picked
+        std::vector<int> nearestLandmark(static_cast<std::size_t>(width) * height, 0);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (isWalkable(x, y)) {
+                    nearestLandmark[static_cast<std::size_t>(y) * width + x] = DijkstraMap::UNREACHABLE;
+                }
+            }
+        }
+
+        auto farthestTile = [&]() {
+            const auto farthest = std::max_element(nearestLandmark.begin(), nearestLandmark.end());
+            const int tile = static_cast<int>(farthest - nearestLandmark.begin());
+            return std::make_tuple(*farthest, tile % width, tile / width);
+        };
+
+        if (landmarkCount <= 0 || nearestLandmark.empty()) {
+            return index;
+        }
+
+        // Start from the tile farthest away from an arbitrary walkable tile
+        const auto [seedDistance, seedX, seedY] = farthestTile();
+        if (seedDistance == 0) {
+            return index;
+        }
+        generateDijkstraMap(landmarkMap, {{seedX, seedY}}, isWalkable);
+        int landmarkX = seedX;
+        int landmarkY = seedY;
+        int farthestDistance = -1;
+        for (int y = 0; y < height; ++y) {
+            const int* row = landmarkMap.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                if (row[x] != DijkstraMap::UNREACHABLE && row[x] > farthestDistance) {
+                    farthestDistance = row[x];
+                    landmarkX = x;
+                    landmarkY = y;
+                }
+            }
+        }
+
+        while (index.getLandmarkCount() < landmarkCount) {
+            generateDijkstraMap(landmarkMap, {{landmarkX, landmarkY}}, isWalkable);
+            index.addLandmark(landmarkX, landmarkY, landmarkMap);
+
+            for (int y = 0; y < height; ++y) {
+                const int* row = landmarkMap.getRow(y);
+                int* nearest = nearestLandmark.data() + static_cast<std::size_t>(y) * width;
+                for (int x = 0; x < width; ++x) {
+                    nearest[x] = std::min(nearest[x], row[x]);
+                }
+            }
+
+            const auto [distance, nextX, nextY] = farthestTile();
+            if (distance == 0) {
+                break;
+            }
+            landmarkX = nextX;
+            landmarkY = nextY;
+        }
+
+        return index;
+    }
+
+    /**
+     * @brief Get the distance between two tiles using A* with landmark bounds
+     *
+     * The heuristic is the larger of the metric estimate and the landmark
+     * bound, so it stays admissible while guiding the search around walls
+     * that the straight-line metric ignores.
+     *
+     * @param workspace Scratch storage sized to the map
+     * @param landmarks Landmark index built for the same walkability
+     * @param start Start position
+     * @param goal Goal position
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @return Distance value, or UNREACHABLE if no path exists or an endpoint is blocked
+     */
+    template<typename WalkableFunc>
+    int queryDistance(SearchWorkspace& workspace,
+                      const LandmarkIndex& landmarks,
+                      const Coord& start,
+                      const Coord& goal,
+                      WalkableFunc isWalkable)
+    {
+        const DistanceType distType = landmarks.getDistanceType();
+        const DijkstraMap metric(0, 0, distType);
+        const auto [goalX, goalY] = goal;
+
+        return detail::searchPath(workspace, start, goal, isWalkable, distType, [&](int x, int y) {
+            return std::max(metric.calculateDistance(x, y, goalX, goalY),
+                            landmarks.getLowerBound(x, y, goalX, goalY));
+        });
+    }
+
+    /**
+     * @brief Find a shortest path between two tiles using A* with landmark bounds
+     *
+     * @param workspace Scratch storage sized to the map
+     * @param landmarks Landmark index built for the same walkability
+     * @param start Start position
+     * @param goal Goal position
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @return Positions from start to goal, both included; empty if no path exists
+     */
+    template<typename WalkableFunc>
+    CoordList findPath(SearchWorkspace& workspace,
+                       const LandmarkIndex& landmarks,
+                       const Coord& start,
+                       const Coord& goal,
+                       WalkableFunc isWalkable)
+    {
+        if (queryDistance(workspace, landmarks, start, goal, isWalkable) == DijkstraMap::UNREACHABLE) {
+            return {};
+        }
+        return detail::reconstructPath(workspace, goal);
+    }
+
+    /**
+     * @brief Build the bit-packed walkability grid used by jump point search
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @return Grid; keep it in sync with walkability changes through setWalkable
+     */
+    template<typename WalkableFunc>
+    JumpPointGrid buildJumpPointGrid(int width,
+                                     int height,
+                                     WalkableFunc isWalkable,
+                                     DistanceType distType = DistanceType::Euclidean)
+    {
+        JumpPointGrid grid(width, height, distType);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (isWalkable(x, y)) {
+                    grid.setWalkable(x, y, true);
+                }
+            }
+        }
+        return grid;
+    }
+
+    /**
+     * @brief Get the distance between two tiles using jump point search
+     *
+     * For Chebyshev and Octile, which move diagonally at uniform cost, only
+     * jump points are expanded. Other distance types have no symmetric paths
+     * to prune this way and run the plain A* of queryDistance instead.
+     *
+     * @param workspace Scratch storage sized to the map; replaced if sized for another map
+     * @param grid Walkability grid built with buildJumpPointGrid
+     * @param start Start position
+     * @param goal Goal position
+     * @return Distance value, or UNREACHABLE if no path exists or an endpoint is blocked
+     */
+    inline int queryDistance(SearchWorkspace& workspace,
+                             const JumpPointGrid& grid,
+                             const Coord& start,
+                             const Coord& goal)
+    {
+        if (detail::usesDiagonalMovement(grid.getDistanceType())) {
+            return detail::searchJumpPoints(workspace, grid, start, goal);
+        }
+
+        auto isWalkable = [&grid](int x, int y) {
+            return grid.isWalkable(x, y);
+        };
+        return queryDistance(workspace, start, goal, isWalkable, grid.getDistanceType());
+    }
+
+    /**
+     * @brief Find a shortest path between two tiles using jump point search
+     *
+     * @param workspace Scratch storage sized to the map; replaced if sized for another map
+     * @param grid Walkability grid built with buildJumpPointGrid
+     * @param start Start position
+     * @param goal Goal position
+     * @return Positions from start to goal, both included; empty if no path exists
+     */
+    inline CoordList findPath(SearchWorkspace& workspace,
+                              const JumpPointGrid& grid,
+                              const Coord& start,
+                              const Coord& goal)
+    {
+        if (queryDistance(workspace, grid, start, goal) == DijkstraMap::UNREACHABLE) {
+            return {};
+        }
+        // Without diagonal movement the parents are already single steps
+        return detail::expandJumpPoints(detail::reconstructPath(workspace, goal));
+    }
+
+    /**
+     * @brief Get the distance between two tiles by searching from both ends
+     *
+     * Needs no heuristic: two Dijkstra frontiers grow from start and goal in
+     * turn and stop as soon as they have met on a shortest path, covering
+     * about half the area of a single search of the same radius.
+     *
+     * @param forward Scratch storage sized to the map, for the search from start
+     * @param backward Scratch storage sized to the map, for the search from goal
+     * @param start Start position
+     * @param goal Goal position
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @return Distance value, or UNREACHABLE if no path exists or an endpoint is blocked
+     */
+    template<typename WalkableFunc>
+    int queryDistanceBidirectional(SearchWorkspace& forward,
+                                   SearchWorkspace& backward,
+                                   const Coord& start,
+                                   const Coord& goal,
+                                   WalkableFunc isWalkable,
+                                   DistanceType distType = DistanceType::Euclidean)
+    {
+        auto tileCost = [&isWalkable](int x, int y) {
+            return isWalkable(x, y) ? 1 : -1;
+        };
+        return detail::searchBidirectional(forward, backward, start, goal, tileCost, distType);
+    }
+
+    /**
+     * @brief Get the weighted distance between two tiles by searching from both ends
+     *
+     * Uses the costs of generateWeightedDijkstraMap: the result equals the
+     * value that function stores at start when goal is the only goal.
+     *
+     * @param forward Scratch storage sized to the map, for the search from goal
+     * @param backward Scratch storage sized to the map, for the search from start
+     * @param start Start position
+     * @param goal Goal position
+     * @param tileCost Function returning the cost to enter a tile, negative if impassable: int(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @return Distance value, or UNREACHABLE if no path exists or an endpoint is impassable
+     */
+    template<typename CostFunc>
+    int queryWeightedDistanceBidirectional(SearchWorkspace& forward,
+                                           SearchWorkspace& backward,
+                                           const Coord& start,
+                                           const Coord& goal,
+                                           CostFunc tileCost,
+                                           DistanceType distType = DistanceType::Euclidean)
+    {
+        // Weighted maps charge for entering tiles on the way out from the goal
+        return detail::searchBidirectional(forward, backward, goal, start, tileCost, distType);
+    }
+
+    /**
+     * @brief Build a contraction hierarchy for fast point-to-point queries on a static map
+     *
+     * Nodes are contracted in rounds. Each round takes every node whose
+     * priority (the edge quotient, shortcuts added per edge removed, on top
+     * of its level of contracted neighbors) beats all its neighbors, finds
+     * their shortcuts in parallel and removes them. Preprocessing takes
+     * seconds on large maps; rebuild when walkability changes.
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @param threadCount Threads to use, 0 for one per hardware thread (default: 0)
+     * @return Contraction hierarchy
+     */
+    template<typename WalkableFunc>
+    ContractionHierarchy buildContractionHierarchy(int width,
+                                                   int height,
+                                                   WalkableFunc isWalkable,
+                                                   DistanceType distType = DistanceType::Euclidean,
+                                                   int threadCount = 0)
+    {
+        const int threads = detail::resolveThreadCount(threadCount);
+        const detail::SharedWalkability sharedWalkability(buildWalkabilityGrid(width, height, isWalkable));
+        const auto isWalkableTile = sharedWalkability.getWalkableFunc();
+
+        // One node per walkable tile, numbered in scan order until ranks are known
+        std::vector<int> tileNodes(static_cast<std::size_t>(width) * height, ContractionHierarchy::NO_NODE);
+        std::vector<int> nodeTiles;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (isWalkableTile(x, y)) {
+                    tileNodes[static_cast<std::size_t>(y) * width + x] = static_cast<int>(nodeTiles.size());
+                    nodeTiles.push_back(y * width + x);
+                }
+            }
+        }
+        const int nodeCount = static_cast<int>(nodeTiles.size());
+
+        const auto& directions = detail::getDirections(distType);
+        const auto& stepCosts = detail::getStepCosts(distType);
+        std::vector<std::vector<detail::ContractionArc>> arcs(nodeCount);
+        for (int node = 0; node < nodeCount; ++node) {
+            const int x = nodeTiles[node] % width;
+            const int y = nodeTiles[node] / width;
+            for (std::size_t direction = 0; direction < directions.size(); ++direction) {
+                const auto [dx, dy] = directions[direction];
+                const int neighborX = x + dx;
+                const int neighborY = y + dy;
+                if (neighborX < 0 || neighborX >= width || neighborY < 0 || neighborY >= height) {
+                    continue;
+                }
+                const int neighbor = tileNodes[static_cast<std::size_t>(neighborY) * width + neighborX];
+                if (neighbor != ContractionHierarchy::NO_NODE) {
+                    arcs[node].push_back({neighbor, stepCosts[direction], ContractionHierarchy::NO_MIDDLE});
+                }
+            }
+        }
+
+        std::vector<SearchWorkspace> workspaces(threads, SearchWorkspace(nodeCount, 1));
+        std::vector<std::vector<detail::ContractionShortcut>> threadShortcuts(threads);
+        std::vector<std::uint8_t> inRound(nodeCount, 0);
+        std::vector<int> levels(nodeCount, 0);
+        std::vector<int> priorities(nodeCount, 0);
+
+        // Contract low levels first, then by edge quotient: shortcuts added per edge removed, in thousandths
+        auto updatePriority = [&](int node, int thread) {
+            detail::findShortcuts(arcs, inRound, node, detail::PRIORITY_SETTLE_LIMIT, workspaces[thread], threadShortcuts[thread]);
+            const int removed = std::max(1, static_cast<int>(arcs[node].size()));
+            priorities[node] = 1000 * levels[node] + 1000 * static_cast<int>(threadShortcuts[thread].size()) / removed;
+        };
+        detail::parallelFor(nodeCount, threads, updatePriority);
+
+        std::vector<int> ranks(nodeCount, -1);
+        std::vector<std::vector<detail::ContractionArc>> upwardArcs(nodeCount);
+        std::vector<int> remaining(nodeCount);
+        for (int node = 0; node < nodeCount; ++node) {
+            remaining[node] = node;
+        }
+
+        int nextRank = 0;
+        std::vector<int> selected;
+        std::vector<int> touched;
+        while (!remaining.empty()) {
+            // Nodes ahead of all their neighbors are independent and can go together
+            selected.clear();
+            for (const int node : remaining) {
+                const bool isLocalMinimum = std::all_of(arcs[node].begin(), arcs[node].end(), [&](const detail::ContractionArc& arc) {
+                    return std::make_tuple(priorities[node], node) < std::make_tuple(priorities[arc.node], arc.node);
+                });
+                if (isLocalMinimum) {
+                    selected.push_back(node);
+                    inRound[node] = 1;
+                }
+            }
+
+            // Witnesses avoid the whole round, so shortcuts stay valid when all of it is removed
+            std::vector<std::vector<detail::ContractionShortcut>> roundShortcuts(selected.size());
+            detail::parallelFor(static_cast<int>(selected.size()), threads, [&](int item, int thread) {
+                detail::findShortcuts(arcs, inRound, selected[item], detail::WITNESS_SETTLE_LIMIT, workspaces[thread],
+                                      roundShortcuts[item]);
+            });
+
+            touched.clear();
+            for (std::size_t item = 0; item < selected.size(); ++item) {
+                const int node = selected[item];
+                ranks[node] = nextRank++;
+                inRound[node] = 0;
+
+                for (const detail::ContractionArc& arc : arcs[node]) {
+                    auto& neighborArcs = arcs[arc.node];
+                    neighborArcs.erase(std::find_if(neighborArcs.begin(), neighborArcs.end(), [node](const detail::ContractionArc& back) {
+                        return back.node == node;
+                    }));
+                    levels[arc.node] = std::max(levels[arc.node], levels[node] + 1);
+                    touched.push_back(arc.node);
+                }
+                upwardArcs[node] = std::move(arcs[node]);
+                arcs[node].clear();
+
+                for (const auto& [from, to, weight] : roundShortcuts[item]) {
+                    detail::addContractionArc(arcs, from, to, weight, node);
+                }
+            }
+
+            remaining.erase(std::remove_if(remaining.begin(), remaining.end(), [&ranks](int node) {
+                return ranks[node] >= 0;
+            }), remaining.end());
+
+            std::sort(touched.begin(), touched.end());
+            touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+            detail::parallelFor(static_cast<int>(touched.size()), threads, [&](int item, int thread) {
+                updatePriority(touched[item], thread);
+            });
+        }
+
+        // Renumber by rank, so every stored edge points to a larger node ID
+        std::vector<int> nodesByRank(nodeCount);
+        for (int node = 0; node < nodeCount; ++node) {
+            nodesByRank[ranks[node]] = node;
+        }
+
+        ContractionHierarchy hierarchy(width, height, distType);
+        for (const int node : nodesByRank) {
+            hierarchy.addNode(nodeTiles[node] % width, nodeTiles[node] / width);
+            std::sort(upwardArcs[node].begin(), upwardArcs[node].end(), [&ranks](const detail::ContractionArc& a, const detail::ContractionArc& b) {
+                return ranks[a.node] < ranks[b.node];
+            });
+            for (const detail::ContractionArc& arc : upwardArcs[node]) {
+                hierarchy.addEdge(ranks[arc.node], arc.weight,
+                                  (arc.middle == ContractionHierarchy::NO_MIDDLE) ? ContractionHierarchy::NO_MIDDLE : ranks[arc.middle]);
+            }
+        }
+        return hierarchy;
+    }
+
+    /**
+     * @brief Get the distance between two tiles from a contraction hierarchy
+     *
+     * Two upward Dijkstra searches that usually settle a few hundred nodes,
+     * whatever the distance between the tiles.
+     *
+     * @param forward Scratch storage sized to the map, for the search from start
+     * @param backward Scratch storage sized to the map, for the search from goal
+     * @param hierarchy Hierarchy built with buildContractionHierarchy
+     * @param start Start position
+     * @param goal Goal position
+     * @return Distance value, or UNREACHABLE if no path exists or an endpoint is blocked
+     */
+    inline int queryDistance(SearchWorkspace& forward,
+                             SearchWorkspace& backward,
+                             const ContractionHierarchy& hierarchy,
+                             const Coord& start,
+                             const Coord& goal)
+    {
+        const auto [distance, meetingNode] = detail::searchContractionHierarchy(forward, backward, hierarchy, start, goal);
+        return distance;
+    }
+
+    /**
+     * @brief Find a shortest path between two tiles from a contraction hierarchy
+     *
+     * Runs the query, then expands every shortcut on the way back into grid steps.
+     *
+     * @param forward Scratch storage sized to the map, for the search from start
+     * @param backward Scratch storage sized to the map, for the search from goal
+     * @param hierarchy Hierarchy built with buildContractionHierarchy
+     * @param start Start position
+     * @param goal Goal position
+     * @return Positions from start to goal, both included; empty if no path exists
+     */
+    inline CoordList findPath(SearchWorkspace& forward,
+                              SearchWorkspace& backward,
+                              const ContractionHierarchy& hierarchy,
+                              const Coord& start,
+                              const Coord& goal)
+    {
+        const auto [distance, meetingNode] = detail::searchContractionHierarchy(forward, backward, hierarchy, start, goal);
+        if (distance == DijkstraMap::UNREACHABLE) {
+            return {};
+        }
+
+        // Nodes from start up to the meeting node, then down to goal
+        const auto [width, height] = hierarchy.getDimensions();
+        const auto [meetingX, meetingY] = hierarchy.getNodePosition(meetingNode);
+        std::vector<int> nodes;
+        for (const int index : {0, 1}) {
+            const SearchWorkspace& side = (index == 0) ? forward : backward;
+            std::vector<int> chain;
+            int x = meetingX;
+            int y = meetingY;
+            while (true) {
+                chain.push_back(hierarchy.getNode(x, y));
+                const int parentIndex = side.getParentIndex(x, y);
+                if (parentIndex == SearchWorkspace::NO_PARENT) {
+                    break;
+                }
+                x = parentIndex % width;
+                y = parentIndex / width;
+            }
+            if (index == 0) {
+                nodes.assign(chain.rbegin(), chain.rend());
+            } else {
+                nodes.insert(nodes.end(), chain.begin() + 1, chain.end());
+            }
+        }
+
+        CoordList path = {hierarchy.getNodePosition(nodes.front())};
+        for (std::size_t i = 1; i < nodes.size(); ++i) {
+            detail::unpackContractionEdge(hierarchy, nodes[i - 1], nodes[i], path);
+        }
+        return path;
+    }
+
+    /**
+     * @brief Build first-move tables for every pair of walkable tiles
+     *
+     * Generates a Dijkstra map toward every walkable tile, on several
+     * threads, and compresses the resulting first moves. This takes one full
+     * map generation per walkable tile, so it is meant for small static maps
+     * built ahead of time.
+     *
+     * Rows are compressed per goal rather than per source: a map toward a goal
+     * gives the first move of every tile toward it by comparing neighbor
+     * distances, while a source row would first need the shortest path tree of
+     * each source walked to carry its first moves outward.
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @param threadCount Threads to use, 0 for one per hardware thread
+     * @return Path database; an empty 0x0 database if the map has more than
+     *         PathDatabase::MAX_TILE_COUNT tiles
+     */
+    template<typename WalkableFunc>
+    PathDatabase buildPathDatabase(int width,
+                                   int height,
+                                   WalkableFunc isWalkable,
+                                   DistanceType distType = DistanceType::Euclidean,
+                                   int threadCount = 0)
+    {
+        if (static_cast<std::int64_t>(width) * height > PathDatabase::MAX_TILE_COUNT) {
+            return PathDatabase(0, 0, distType);
+        }
+
+        const int threads = detail::resolveThreadCount(threadCount);
+        const int tileCount = width * height;
+
+        PathDatabase database(width, height, distType);
+        const detail::SharedWalkability sharedWalkability(buildWalkabilityGrid(width, height, isWalkable));
+        const BitGrid& walkable = sharedWalkability.getGrid();
+        const auto isWalkableTile = sharedWalkability.getWalkableFunc();
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                database.setWalkable(x, y, walkable.get(x, y));
+            }
+        }
+
+        std::vector<DijkstraMap> maps(threads, DijkstraMap(width, height, distType));
+        std::vector<std::vector<std::tuple<int, int>>> rows(tileCount);
+        detail::parallelFor(tileCount, threads, [&](int goalTile, int thread) {
+            const int goalX = goalTile % width;
+            const int goalY = goalTile / width;
+            if (walkable.get(goalX, goalY)) {
+                generateDijkstraMap(maps[thread], {{goalX, goalY}}, isWalkableTile);
+                detail::encodeFirstMoves(maps[thread], walkable, goalTile, rows[goalTile]);
+            }
+        });
+
+        for (auto& row : rows) {
+            database.addRow();
+            for (const auto& [firstTile, move] : row) {
+                database.addRun(firstTile, move);
+            }
+            std::vector<std::tuple<int, int>>().swap(row);
+        }
+        return database;
+    }
+
+    /**
+     * @brief Extract a shortest path by following first moves
+     *
+     * Needs one table lookup per step and no search, heap or queue.
+     *
+     * @param database Path database built with buildPathDatabase
+     * @param start Start position
+     * @param goal Goal position
+     * @return Tiles from start to goal inclusive, or empty if no path exists or an endpoint is blocked
+     */
+    inline CoordList extractPath(const PathDatabase& database, const Coord& start, const Coord& goal)
+    {
+        const auto [startX, startY] = start;
+        const auto [goalX, goalY] = goal;
+        if (!database.isWalkable(startX, startY) || !database.isWalkable(goalX, goalY)) {
+            return {};
+        }
+
+        const auto [width, height] = database.getDimensions();
+        const auto& directions = detail::getDirections(database.getDistanceType());
+
+        CoordList path = {start};
+        int x = startX;
+        int y = startY;
+        while (x != goalX || y != goalY) {
+            const int move = database.getFirstMove(x, y, goalX, goalY);
+            // A shortest path never visits a tile twice
+            if (move == PathDatabase::NO_MOVE || static_cast<int>(path.size()) >= width * height) {
+                return {};
+            }
+
+            const auto [dx, dy] = directions[move];
+            x += dx;
+            y += dy;
+            path.emplace_back(x, y);
+        }
+        return path;
+    }
+
+    /**
+     * @brief Compute the distances from every source to every target
+     *
+     * Runs one Dijkstra search per source, on several threads. A search stops
+     * as soon as every target tile in the source's connected component is
+     * settled, so targets close to each other cost far less than full map
+     * generations.
+     *
+     * @param width Width of the map
+     * @param height Height of the map
+     * @param sources Source positions, one matrix row each
+     * @param targets Target positions, one matrix column each
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param distType Distance type to use (default: Euclidean)
+     * @param threadCount Threads to use, 0 for one per hardware thread
+     * @return Matrix of distances; UNREACHABLE for blocked, out-of-bounds or unconnected pairs
+     */
+    template<typename WalkableFunc>
+    DistanceMatrix distanceMatrix(int width,
+                                  int height,
+                                  const CoordList& sources,
+                                  const CoordList& targets,
+                                  WalkableFunc isWalkable,
+                                  DistanceType distType = DistanceType::Euclidean,
+                                  int threadCount = 0)
+    {
+        const int sourceCount = static_cast<int>(sources.size());
+        const int targetCount = static_cast<int>(targets.size());
+        DistanceMatrix matrix(sourceCount, targetCount);
+
+        const detail::SharedWalkability sharedWalkability(buildWalkabilityGrid(width, height, isWalkable));
+        const auto isWalkableTile = sharedWalkability.getWalkableFunc();
+        const ComponentLabels components = labelComponents(width, height, isWalkableTile, distType);
+
+        // Distinct target tiles per component, so searches never wait for unreachable targets
+        BitGrid targetTiles(width, height);
+        std::vector<int> componentTargetCounts(components.getComponentCount(), 0);
+        for (const auto& [targetX, targetY] : targets) {
+            const int label = components.getLabel(targetX, targetY);
+            if (label != ComponentLabels::NO_COMPONENT && !targetTiles.get(targetX, targetY)) {
+                targetTiles.set(targetX, targetY);
+                ++componentTargetCounts[label];
+            }
+        }
+
+        const int threads = detail::resolveThreadCount(threadCount);
+        std::vector<SearchWorkspace> workspaces(threads, SearchWorkspace(width, height));
+        detail::parallelFor(sourceCount, threads, [&](int source, int thread) {
+            const auto [sourceX, sourceY] = sources[source];
+            const int label = components.getLabel(sourceX, sourceY);
+            if (label == ComponentLabels::NO_COMPONENT) {
+                return;
+            }
+
+            SearchWorkspace& workspace = workspaces[thread];
+            detail::settleTargets(workspace, sources[source], targetTiles, componentTargetCounts[label],
+                                  isWalkableTile, distType);
+
+            int* row = matrix.getRow(source);
+            for (int target = 0; target < targetCount; ++target) {
+                const auto [targetX, targetY] = targets[target];
+                if (components.getLabel(targetX, targetY) == label) {
+                    row[target] = workspace.getDistance(targetX, targetY);
+                }
+            }
+        });
+        return matrix;
+    }
+
+    /**
+     * @brief Generate the distances to the K nearest goals of every tile in one propagation
+     *
+     * Each tile carries up to K (distance, goal) pairs through the flood fill.
+     * A goal that is not among a tile's K nearest is not passed on from that
+     * tile, because every tile behind it is at least as close to those K. The
+     * cost grows with K, not with the number of goals.
+     *
+     * @param nearestMap The map to populate
+     * @param goals Goal positions; a goal's ID is its index in this list
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     */
+    template<int K, typename WalkableFunc>
+    void generateNearestGoalsMap(NearestGoalsMap<K>& nearestMap, const CoordList& goals, WalkableFunc isWalkable)
+    {
+        nearestMap.clear();
+        const auto [width, height] = nearestMap.getDimensions();
+
+        // Read walkability once instead of once per carried goal
+        std::vector<char> walkable(static_cast<std::size_t>(width) * height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                walkable[static_cast<std::size_t>(y) * width + x] = isWalkable(x, y);
+            }
+        }
+
+        const auto& directions = detail::getDirections(nearestMap.getDistanceType());
+        const auto& stepCosts = detail::getStepCosts(nearestMap.getDistanceType());
+        const int directionCount = static_cast<int>(directions.size());
+
+        BucketQueue queue(*std::max_element(stepCosts.begin(), stepCosts.end()));
+        for (int goal = 0; goal < static_cast<int>(goals.size()); ++goal) {
+            const auto [goalX, goalY] = goals[goal];
+            if (!nearestMap.isWithinBounds(goalX, goalY) || !walkable[static_cast<std::size_t>(goalY) * width + goalX]) {
+                continue;
+            }
+
+            if (detail::insertNearestGoal<K>(nearestMap.getSlots(goalX, goalY), 0, goal)) {
+                queue.push(0, goalY * width + goalX);
+            }
+        }
+
+        // Distance at which each tile was last expanded, to skip duplicate entries
+        std::vector<int> expandedAt(walkable.size(), -1);
+
+        while (!queue.empty()) {
+            const auto [currentDist, currentIndex] = queue.pop();
+            const int currentX = currentIndex % width;
+            const int currentY = currentIndex / width;
+
+            const auto* current = nearestMap.getSlots(currentX, currentY);
+            const bool anySettled = std::any_of(current, current + K,
+                                                [currentDist](const auto& slot) { return slot.distance == currentDist; });
+            if (expandedAt[currentIndex] == currentDist || !anySettled) {
+                continue;
+            }
+            expandedAt[currentIndex] = currentDist;
+
+            for (int direction = 0; direction < directionCount; ++direction) {
+                const auto [dx, dy] = directions[direction];
+                const int neighborX = currentX + dx;
+                const int neighborY = currentY + dy;
+                const int neighborIndex = neighborY * width + neighborX;
+                if (!nearestMap.isWithinBounds(neighborX, neighborY) || !walkable[neighborIndex]) {
+                    continue;
+                }
+
+                // Pass on every goal settled at this distance; all arrive at the same value
+                const int newDistance = currentDist + stepCosts[direction];
+                auto* neighbor = nearestMap.getSlots(neighborX, neighborY);
+                bool improved = false;
+                for (int rank = 0; rank < K; ++rank) {
+                    if (current[rank].distance == currentDist) {
+                        improved |= detail::insertNearestGoal<K>(neighbor, newDistance, current[rank].goal);
+                    }
+                }
+
+                if (improved) {
+                    queue.push(newDistance, neighborIndex);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Generate a Dijkstra map and record the order tiles were settled in
+     *
+     * Runs the flood fill over a bucket queue, so tiles are settled level by
+     * level; the level boundaries let band queries on the settle order skip
+     * any scan of the map. Distances equal those of generateDijkstraMap.
+     *
+     * @param dijkstraMap The map to populate with distances
+     * @param goals Vector of goal positions (distance 0)
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param settleOrder Order to fill; cleared first
+     */
+    template<typename WalkableFunc>
+    void generateDijkstraMap(DijkstraMap& dijkstraMap,
+                             const CoordList& goals,
+                             WalkableFunc isWalkable,
+                             SettleOrder& settleOrder)
+    {
+        dijkstraMap.clear();
+        settleOrder.clear();
+        detail::propagateByLevels(
+            dijkstraMap, goals, isWalkable,
+            [&](int x, int y, int distance) { settleOrder.addTile(x, y, distance); },
+            [](int, int, int, int) {});
+    }
+
+    /**
+     * @brief Find the tiles with a distance in a band from a recorded settle order
+     *
+     * @param settleOrder Settle order recorded while generating the map
+     * @param minDistance Smallest distance of the band
+     * @param maxDistance Largest distance of the band, inclusive; equal to minDistance for a ring
+     * @return Tiles of the band in settle order
+     */
+    inline CoordList findTilesInBand(const SettleOrder& settleOrder, int minDistance, int maxDistance)
+    {
+        const auto [first, last] = settleOrder.findBand(minDistance, maxDistance);
+
+        CoordList tiles;
+        tiles.reserve(static_cast<std::size_t>(last - first));
+        for (int index = first; index < last; ++index) {
+            tiles.push_back(settleOrder.getTile(index));
+        }
+        return tiles;
+    }
+
+    /**
+     * @brief Find the tiles with a distance in a band as run-length spans per row
+     *
+     * Scans the map storage row by row with a vectorizable compare, for maps
+     * generated without a settle order.
+     *
+     * @param dijkstraMap The Dijkstra map to scan
+     * @param minDistance Smallest distance of the band
+     * @param maxDistance Largest distance of the band, inclusive; equal to minDistance for a ring
+     * @return Spans of reachable tiles in the band, row by row
+     */
+    inline std::vector<TileSpan> findBandSpans(const DijkstraMap& dijkstraMap, int minDistance, int maxDistance)
+    {
+        std::vector<TileSpan> bandSpans;
+        if (minDistance > maxDistance) {
+            return bandSpans;
+        }
+
+        const auto [width, height] = dijkstraMap.getDimensions();
+        std::vector<std::uint8_t> inBand(width);
+        for (int y = 0; y < height; ++y) {
+            if (detail::markBandRow(dijkstraMap.getRow(y), width, minDistance, maxDistance, inBand.data()) == 0) {
+                continue;
+            }
+
+            int x = detail::skipBandFlags(inBand.data(), 0, width, 0);
+            while (x < width) {
+                const int spanEnd = detail::skipBandFlags(inBand.data(), x, width, 1);
+                bandSpans.push_back({y, x, spanEnd});
+                x = detail::skipBandFlags(inBand.data(), spanEnd, width, 0);
+            }
+        }
+        return bandSpans;
+    }
+
+    /**
+     * @brief Find the tiles with a distance in a band by scanning the map
+     *
+     * @param dijkstraMap The Dijkstra map to scan
+     * @param minDistance Smallest distance of the band
+     * @param maxDistance Largest distance of the band, inclusive; equal to minDistance for a ring
+     * @return Tiles of the band in scan order
+     */
+    inline CoordList findTilesInBand(const DijkstraMap& dijkstraMap, int minDistance, int maxDistance)
+    {
+        CoordList tiles;
+        for (const auto& [y, xBegin, xEnd] : findBandSpans(dijkstraMap, minDistance, maxDistance)) {
+            for (int x = xBegin; x < xEnd; ++x) {
+                tiles.emplace_back(x, y);
+            }
+        }
+        return tiles;
+    }
+
+    /**
+     * @brief Find the reachable tiles farthest from the goals
+     *
+     * A vectorized pass finds the largest distance of every row. Rows are then
+     * visited from the largest maximum down, and scanning stops once no
+     * remaining row can hold a tile farther than the ones already found.
+     *
+     * @param dijkstraMap The Dijkstra map to analyze
+     * @param count Number of tiles to return
+     * @return Up to count tiles, farthest first; ties in scan order
+     */
+    inline CoordList findFarthestTiles(const DijkstraMap& dijkstraMap, int count)
+    {
+        const auto [width, height] = dijkstraMap.getDimensions();
+        if (count <= 0) {
+            return {};
+        }
+
+        std::vector<std::tuple<int, int>> rows;
+        for (int y = 0; y < height; ++y) {
+            const int rowMax = detail::findRowMaxDistance(dijkstraMap.getRow(y), width);
+            if (rowMax != std::numeric_limits<int>::min()) {
+                rows.emplace_back(rowMax, y);
+            }
+        }
+        std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+            const auto [aMax, aY] = a;
+            const auto [bMax, bY] = b;
+            return aMax > bMax || (aMax == bMax && aY < bY);
+        });
+
+        // Best tiles so far as (distance, -tile index); the heap top is the one to drop next
+        using Candidate = std::tuple<int, int>;
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> best;
+        for (const auto& [rowMax, y] : rows) {
+            if (static_cast<int>(best.size()) == count) {
+                const auto [worstDistance, worstTile] = best.top();
+                if (rowMax < worstDistance) {
+                    break;
+                }
+            }
+
+            const int* row = dijkstraMap.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                if (row[x] == DijkstraMap::UNREACHABLE) {
+                    continue;
+                }
+                const Candidate candidate(row[x], -(y * width + x));
+                if (static_cast<int>(best.size()) < count) {
+                    best.push(candidate);
+                } else if (best.top() < candidate) {
+                    best.pop();
+                    best.push(candidate);
+                }
+            }
+        }
+
+        CoordList farthest(best.size());
+        for (auto tile = farthest.rbegin(); tile != farthest.rend(); ++tile) {
+            const auto [distance, negativeIndex] = best.top();
+            *tile = Coord(-negativeIndex % width, -negativeIndex / width);
+            best.pop();
+        }
+        return farthest;
+    }
+
+    /**
+     * @brief Find the farthest tiles from a recorded settle order
+     *
+     * The flood fill settles tiles in nondecreasing distance, so the farthest
+     * tiles are the last ones settled and no scan is needed.
+     *
+     * @param settleOrder Settle order recorded while generating the map
+     * @param count Number of tiles to return
+     * @return Up to count tiles, farthest first; ties in reverse settle order
+     */
+    inline CoordList findFarthestTiles(const SettleOrder& settleOrder, int count)
+    {
+        const int first = std::max(0, settleOrder.getTileCount() - std::max(0, count));
+
+        CoordList farthest;
+        for (int index = settleOrder.getTileCount() - 1; index >= first; --index) {
+            farthest.push_back(settleOrder.getTile(index));
+        }
+        return farthest;
+    }
+
+    /**
+     * @brief Count the reachable tiles per distance bucket
+     *
+     * A vectorized pass finds the largest distance to size the histogram,
+     * then one branch-free pass counts tiles. Unreachable tiles and tiles
+     * with a negative distance are not counted.
+     *
+     * @param dijkstraMap The Dijkstra map to analyze
+     * @param bucketWidth Width of each bucket; bucket i counts distances in [i * bucketWidth, (i + 1) * bucketWidth)
+     * @return Tile count per bucket, up to the bucket of the largest distance; empty if bucketWidth <= 0
+     */
+    inline std::vector<int> computeDistanceHistogram(const DijkstraMap& dijkstraMap, int bucketWidth)
+    {
+        const auto [width, height] = dijkstraMap.getDimensions();
+        if (bucketWidth <= 0) {
+            return {};
+        }
+
+        int maxDistance = -1;
+        for (int y = 0; y < height; ++y) {
+            maxDistance = std::max(maxDistance, detail::findRowMaxDistance(dijkstraMap.getRow(y), width));
+        }
+
+        // Divide by a multiply and shift, exact for all non-negative ints (Granlund-Montgomery)
+        int log2Width = 0;
+        while ((1ll << log2Width) < bucketWidth) {
+            ++log2Width;
+        }
+        const int shift = 31 + log2Width;
+        const std::uint64_t multiplier = ((std::uint64_t{1} << shift) + bucketWidth - 1) / bucketWidth;
+
+        // Tiles that are not counted go to an extra last bucket, selected with a
+        // mask rather than a branch that would mispredict on scattered walls
+        const std::size_t bucketCount = (maxDistance < 0) ? 0 : static_cast<std::size_t>(maxDistance / bucketWidth) + 1;
+        std::vector<int> histogram(bucketCount + 1, 0);
+        for (int y = 0; y < height; ++y) {
+            const int* row = dijkstraMap.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                const std::uint32_t distance = static_cast<std::uint32_t>(row[x]);
+                const std::uint64_t countedMask = 0 - static_cast<std::uint64_t>(
+                    distance < static_cast<std::uint32_t>(DijkstraMap::UNREACHABLE));
+                const std::uint64_t bucket = (static_cast<std::uint64_t>(distance) * multiplier) >> shift;
+                ++histogram[(bucket & countedMask) | (bucketCount & ~countedMask)];
+            }
+        }
+        histogram.pop_back();
+        return histogram;
+    }
+
+    /**
+     * @brief Convert a Dijkstra map into a flow field
+     *
+     * Every tile points to the neighbor that minimizes neighbor distance plus
+     * step cost, the lowest direction index on ties, if that does not exceed
+     * the tile's own distance; on a generated map this is the first step of a
+     * shortest path. Rows are read straight from the map storage by a
+     * vectorized kernel, in blocks of rows spread over threads.
+     *
+     * @param dijkstraMap The Dijkstra map to descend
+     * @param threadCount Threads to use, 0 for one per hardware thread (default: 0)
+     * @return Flow field with the map's dimensions and distance type
+     */
+    inline FlowField generateFlowField(const DijkstraMap& dijkstraMap, int threadCount = 0)
+    {
+        constexpr int rowsPerBlock = 32;
+        const auto [width, height] = dijkstraMap.getDimensions();
+        const DistanceType distType = dijkstraMap.getDistanceType();
+        const auto& stepCosts = detail::getStepCosts(distType);
+        const int straightCost = stepCosts[0];
+        const int diagonalCost = stepCosts.back();
+
+        FlowField flowField(width, height, distType);
+        const std::vector<int> unreachableRow(width, DijkstraMap::UNREACHABLE);
+        const int blockCount = (height + rowsPerBlock - 1) / rowsPerBlock;
+        detail::parallelFor(blockCount, detail::resolveThreadCount(threadCount), [&](int block, int) {
+            const int lastY = std::min(height, (block + 1) * rowsPerBlock);
+            for (int y = block * rowsPerBlock; y < lastY; ++y) {
+                const int* above = (y > 0) ? dijkstraMap.getRow(y - 1) : unreachableRow.data();
+                const int* below = (y + 1 < height) ? dijkstraMap.getRow(y + 1) : unreachableRow.data();
+                std::uint8_t* flow = flowField.getRow(y);
+                if (width < detail::FLOW_BLOCK_SIZE + 2) {
+                    for (int x = 0; x < width; ++x) {
+                        flowField.setDirection(x, y, detail::findFlowDirection(dijkstraMap, x, y));
+                    }
+                    continue;
+                }
+                if (detail::usesDiagonalMovement(distType)) {
+                    detail::computeFlowRow<true>(above, dijkstraMap.getRow(y), below, width,
+                                                 straightCost, diagonalCost, flow);
+                } else {
+                    detail::computeFlowRow<false>(above, dijkstraMap.getRow(y), below, width,
+                                                  straightCost, diagonalCost, flow);
+                }
+                flowField.setDirection(0, y, detail::findFlowDirection(dijkstraMap, 0, y));
+                flowField.setDirection(width - 1, y, detail::findFlowDirection(dijkstraMap, width - 1, y));
+            }
+        });
+        return flowField;
+    }
+
+    /**
+     * @brief Generate a Dijkstra map and its flow field in the same pass
+     *
+     * Every step the flood fill relaxes records the direction back to the
+     * tile it came from, so no second pass over the map is needed. The field
+     * equals generateFlowField of the generated map.
+     *
+     * @param dijkstraMap The map to populate with distances
+     * @param goals Vector of goal positions (distance 0)
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param flowField Field to fill, with the map's dimensions; cleared first
+     */
+    template<typename WalkableFunc>
+    void generateDijkstraMap(DijkstraMap& dijkstraMap,
+                             const CoordList& goals,
+                             WalkableFunc isWalkable,
+                             FlowField& flowField)
+    {
+        dijkstraMap.clear();
+        flowField.clear();
+        flowField.setDistanceType(dijkstraMap.getDistanceType());
+        detail::propagateByLevels(
+            dijkstraMap, goals, isWalkable,
+            [](int, int, int) {},
+            [&](int x, int y, int direction, int distance) {
+                // A shorter path replaces the direction; an equal one keeps the lowest index
+                const int backDirection = detail::getOppositeDirection(direction);
+                if (distance < dijkstraMap.getDistance(x, y) || backDirection < flowField.getDirection(x, y)) {
+                    flowField.setDirection(x, y, backDirection);
+                }
+            });
+    }
+
+    /**
+     * @brief Combine Dijkstra maps into their weighted sum
+     *
+     * Writes CombinedMapView::getDistance of every tile in one streaming,
+     * vectorized pass over the rows: sums are rounded to the nearest integer
+     * and saturated below UNREACHABLE, and a tile unreachable in any map is
+     * UNREACHABLE. Maps with other dimensions than the output fall back to
+     * per-tile evaluation, with tiles outside them unreachable. Like an empty
+     * CombinedMapView, no terms leave every tile UNREACHABLE.
+     *
+     * @param combined Output map, may be one of the terms; keeps its dimensions and distance type
+     * @param terms Maps and their weights, e.g. {{goalMap, 1.0}, {fleeMap, -1.2}}
+     */
+    inline void combineMaps(DijkstraMap& combined, const std::vector<WeightedMap>& terms)
+    {
+        if (terms.empty()) {
+            combined.clear();
+            return;
+        }
+
+        const auto [width, height] = combined.getDimensions();
+        const bool sameDimensions = std::all_of(terms.begin(), terms.end(), [&](const WeightedMap& term) {
+            return term.map.getDimensions() == combined.getDimensions();
+        });
+
+        if (!sameDimensions) {
+            // Write to a new map first: the output may be one of the terms
+            const CombinedMapView view(terms);
+            DijkstraMap result(width, height, combined.getDistanceType());
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    result.setDistance(x, y, view.getDistance(x, y));
+                }
+            }
+            combined = std::move(result);
+            return;
+        }
+
+        for (int y = 0; y < height; ++y) {
+            detail::combineRow(terms, y, width, combined.getRow(y));
+        }
+    }
+
+    /**
+     * @brief Generate the summed, decayed influence of many sources
+     *
+     * Every source adds strength times the falloff of its distance to each
+     * tile within the cutoff. Decayed values are written while a bounded
+     * flood fill runs from the source, so no full Dijkstra map per source is
+     * needed. Sources are spread over threads; each thread records its
+     * fixed-point values by block of rows, so memory grows with the tiles
+     * the sources reach rather than with the map size times the thread
+     * count. The blocks are then added up on the same threads. Totals
+     * saturate to the int range of raw units. A negative cutoff reaches no
+     * tile, not even the sources, and leaves the map at 0.
+     *
+     * @param influenceMap The map to populate; its distance type selects connectivity and step costs
+     * @param sources Positions and strengths; sources on walls or out of bounds are ignored
+     * @param isWalkable Function to determine if a tile is walkable: bool(int x, int y)
+     * @param falloff Falloff shape and cutoff (default: exponential, cutoff 10, half-life 3)
+     * @param threadCount Threads to use, 0 for one per hardware thread (default: 0)
+     */
+    template<typename WalkableFunc>
+    void generateInfluenceMap(InfluenceMap& influenceMap,
+                              const std::vector<InfluenceSource>& sources,
+                              WalkableFunc isWalkable,
+                              const InfluenceFalloff& falloff = {},
+                              int threadCount = 0)
+    {
+        constexpr int rowsPerBlock = 32;
+        const auto [width, height] = influenceMap.getDimensions();
+        const DistanceType distType = influenceMap.getDistanceType();
+        const int blockCount = (height + rowsPerBlock - 1) / rowsPerBlock;
+
+        if (falloff.cutoff < 0) {
+            influenceMap.clear();
+            return;
+        }
+
+        const detail::SharedWalkability sharedWalkability(buildWalkabilityGrid(width, height, isWalkable));
+        const auto isWalkableTile = sharedWalkability.getWalkableFunc();
+
+        // Influence of a source on one tile: offset within its block of rows, and raw value
+        using InfluenceRecord = std::tuple<int, int>;
+
+        const std::int64_t windowSide = detail::getInfluenceWindowSide(falloff.cutoff, distType);
+        const int windowWidth = static_cast<int>(std::min<std::int64_t>(width, windowSide));
+        const int windowHeight = static_cast<int>(std::min<std::int64_t>(height, windowSide));
+
+        const int threads = detail::resolveThreadCount(threadCount);
+        const int sourceThreads = std::max(1, std::min(threads, static_cast<int>(sources.size())));
+        std::vector<SearchWorkspace> workspaces(sourceThreads, SearchWorkspace(windowWidth, windowHeight));
+        std::vector<std::vector<InfluenceRecord>> records(static_cast<std::size_t>(sourceThreads) * blockCount);
+        detail::parallelFor(static_cast<int>(sources.size()), sourceThreads, [&](int source, int thread) {
+            if (!isWalkableTile(sources[source].x, sources[source].y)) {
+                return;
+            }
+            std::vector<InfluenceRecord>* threadRecords = records.data() + static_cast<std::size_t>(thread) * blockCount;
+            detail::spreadInfluence(workspaces[thread], width, height, sources[source], isWalkableTile, distType, falloff,
+                [&](int x, int y, int influence) {
+                    threadRecords[y / rowsPerBlock].emplace_back((y % rowsPerBlock) * width + x, influence);
+                });
+        });
+
+        std::vector<std::vector<std::int64_t>> blockSums(threads);
+        detail::parallelFor(blockCount, threads, [&](int block, int thread) {
+            std::vector<std::int64_t>& sums = blockSums[thread];
+            sums.assign(static_cast<std::size_t>(rowsPerBlock) * width, 0);
+            for (int sourceThread = 0; sourceThread < sourceThreads; ++sourceThread) {
+                for (const auto& [offset, influence] : records[static_cast<std::size_t>(sourceThread) * blockCount + block]) {
+                    sums[offset] += influence;
+                }
+            }
+
+            const int firstY = block * rowsPerBlock;
+            const int lastY = std::min(height, firstY + rowsPerBlock);
+            for (int y = firstY; y < lastY; ++y) {
+                int* row = influenceMap.getRow(y);
+                const std::int64_t* rowSums = sums.data() + static_cast<std::size_t>(y - firstY) * width;
+                for (int x = 0; x < width; ++x) {
+                    row[x] = static_cast<int>(std::clamp<std::int64_t>(rowSums[x], std::numeric_limits<int>::min(),
+                                                                        std::numeric_limits<int>::max()));
+                }
+            }
+        });
     }
 }
\ No newline at end of file
@@ -1,13 +1,9 @@
 #include <benchmark/benchmark.h>
 #include "DijkstraMapLib.hpp"
+#include "tests/test_maps.hpp"
 
 using namespace DijkstraMapLib;
 
-// Simple walkable function for benchmarks
-static bool allWalkable(int, int) {
-    return true;
-}
-
 // Benchmark: Single goal, small map (10x10)
 static void SingleGoalSmallMap(benchmark::State& state) {
     constexpr int size = 10;
@@ -146,6 +142,867 @@ static void EuclideanDistance(benchmark::State& state) {
 }
 BENCHMARK(EuclideanDistance);
 
+// Benchmark: Octile distance (8-directional, fixed-point costs)
+static void OctileDistance(benchmark::State& state) {
+    constexpr int size = 100;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, allWalkable);
+        benchmark::DoNotOptimize(map.getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(OctileDistance);
+
+// Benchmark: Exact Euclidean distance transform on an open map
+static void EuclideanTransformOpen(benchmark::State& state) {
+    constexpr int size = 100;
+    DijkstraMap map(size, size, DistanceType::Euclidean);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, allWalkable, GenerationEngine::EuclideanTransform);
+        benchmark::DoNotOptimize(map.getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(EuclideanTransformOpen);
+
+// Benchmark: Euclidean distance transform around a wall (line-of-sight anchors)
+static void EuclideanTransformWithWall(benchmark::State& state) {
+    constexpr int size = 100;
+    DijkstraMap map(size, size, DistanceType::Euclidean);
+    CoordList goals = {{25, 50}};
+
+    // Vertical wall with a gap at the bottom
+    auto walkableWithWall = [](int x, int y) {
+        return x != 50 || y > 90;
+    };
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, walkableWithWall, GenerationEngine::EuclideanTransform);
+        benchmark::DoNotOptimize(map.getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(EuclideanTransformWithWall);
+
+// Serpentine maze: horizontal walls with gaps alternating between the two ends
+static bool serpentineWalkable(int x, int y) {
+    constexpr int size = 100;
+    if (y % 2 == 0) {
+        return true;
+    }
+    return ((y / 2) % 2 == 0) ? x == size - 1 : x == 0;
+}
+
+// Benchmark: Flood fill vs chamfer sweep on open, cave and maze maps
+template<bool (*Walkable)(int, int)>
+static void EngineComparison(benchmark::State& state) {
+    constexpr int size = 100;
+    const auto engine = static_cast<GenerationEngine>(state.range(0));
+    DijkstraMap map(size, size, DistanceType::Manhattan);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, Walkable, engine);
+        benchmark::DoNotOptimize(map.getDistance(size - 1, size - 1));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK_TEMPLATE(EngineComparison, allWalkable)
+    ->ArgName("engine")->Arg(static_cast<int>(GenerationEngine::FloodFill))
+    ->Arg(static_cast<int>(GenerationEngine::ChamferSweep));
+BENCHMARK_TEMPLATE(EngineComparison, scatteredWalls)
+    ->ArgName("engine")->Arg(static_cast<int>(GenerationEngine::FloodFill))
+    ->Arg(static_cast<int>(GenerationEngine::ChamferSweep));
+BENCHMARK_TEMPLATE(EngineComparison, serpentineWalkable)
+    ->ArgName("engine")->Arg(static_cast<int>(GenerationEngine::FloodFill))
+    ->Arg(static_cast<int>(GenerationEngine::ChamferSweep));
+
+// Smooth terrain cost field for weighted benchmarks
+static int terrainCost(int x, int y) {
+    return 1 + ((x * 7 + y * 3) / 40) % 4;
+}
+
+// Benchmark: Weighted map over a terrain cost field, heap-based
+static void WeightedTerrainHeap(benchmark::State& state) {
+    constexpr int size = 200;
+    DijkstraMap map(size, size, DistanceType::Manhattan);
+    CoordList goals = {{100, 100}};
+
+    for (auto _ : state) {
+        generateWeightedDijkstraMap(map, goals, terrainCost);
+        benchmark::DoNotOptimize(map.getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(WeightedTerrainHeap);
+
+// Benchmark: Weighted map over a terrain cost field, fast sweeping
+static void WeightedTerrainSweeping(benchmark::State& state) {
+    constexpr int size = 200;
+    DijkstraMap map(size, size, DistanceType::Manhattan);
+    CoordList goals = {{100, 100}};
+
+    for (auto _ : state) {
+        SweepResult result = generateWeightedDijkstraMapBySweeping(map, goals, terrainCost);
+        benchmark::DoNotOptimize(result.iterations);
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(WeightedTerrainSweeping);
+
+// Benchmark: Weighted point query searched from both ends
+static void WeightedTerrainBidirectional(benchmark::State& state) {
+    constexpr int size = 200;
+    SearchWorkspace forward(size, size);
+    SearchWorkspace backward(size, size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryWeightedDistanceBidirectional(forward, backward, {150, 60}, {100, 100},
+                                                                    terrainCost, DistanceType::Manhattan));
+    }
+}
+BENCHMARK(WeightedTerrainBidirectional);
+
+// Dungeon of 20x20 rooms joined by doors in the dividing walls
+static bool roomsWalkable(int x, int y) {
+    const bool wallColumn = x % 21 == 20;
+    const bool wallRow = y % 21 == 20;
+    if (wallColumn && wallRow) {
+        return false;
+    }
+    if (wallColumn) {
+        return y % 21 == 7;
+    }
+    if (wallRow) {
+        return x % 21 == 13;
+    }
+    return true;
+}
+
+// Benchmark: Open dungeon, tile-by-tile flood fill
+static void RoomsFloodFill(benchmark::State& state) {
+    constexpr int size = 209;
+    DijkstraMap map(size, size, DistanceType::Chebyshev);
+    CoordList goals = {{100, 100}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, roomsWalkable);
+        benchmark::DoNotOptimize(map.getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(RoomsFloodFill);
+
+// Benchmark: Open dungeon, propagation across a prebuilt rectangle decomposition
+static void RoomsFromRectangles(benchmark::State& state) {
+    constexpr int size = 209;
+    DijkstraMap map(size, size, DistanceType::Chebyshev);
+    RectangleDecomposition decomposition = decomposeIntoRectangles(size, size, roomsWalkable);
+    CoordList goals = {{100, 100}};
+
+    for (auto _ : state) {
+        generateDijkstraMapFromRectangles(map, decomposition, goals);
+        benchmark::DoNotOptimize(map.getDistance(0, 0));
+    }
+
+    state.counters["rectangles"] = decomposition.getRectangleCount();
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(RoomsFromRectangles);
+
+// Perfect maze of 1-wide corridors carved by a seeded depth-first search
+static const std::vector<bool>& perfectMaze() {
+    constexpr int size = 201;
+    static std::vector<bool> walkable;
+    if (!walkable.empty()) {
+        return walkable;
+    }
+
+    walkable.assign(size * size, false);
+    std::vector<std::tuple<int, int>> stack = {{1, 1}};
+    walkable[1 * size + 1] = true;
+    unsigned seed = 12345u;
+
+    while (!stack.empty()) {
+        const auto [x, y] = stack.back();
+        std::vector<std::tuple<int, int>> unvisited;
+        for (const auto& [dx, dy] : {std::make_tuple(2, 0), std::make_tuple(-2, 0),
+                                     std::make_tuple(0, 2), std::make_tuple(0, -2)}) {
+            const int nextX = x + dx;
+            const int nextY = y + dy;
+            if (nextX > 0 && nextX < size && nextY > 0 && nextY < size && !walkable[nextY * size + nextX]) {
+                unvisited.emplace_back(nextX, nextY);
+            }
+        }
+
+        if (unvisited.empty()) {
+            stack.pop_back();
+            continue;
+        }
+
+        seed = seed * 1103515245u + 12345u;
+        const auto [nextX, nextY] = unvisited[(seed >> 16) % unvisited.size()];
+        walkable[((y + nextY) / 2) * size + (x + nextX) / 2] = true;
+        walkable[nextY * size + nextX] = true;
+        stack.emplace_back(nextX, nextY);
+    }
+
+    return walkable;
+}
+
+static bool mazeWalkable(int x, int y) {
+    return perfectMaze()[y * 201 + x];
+}
+
+// Benchmark: Perfect maze, tile-by-tile flood fill
+static void MazeFloodFill(benchmark::State& state) {
+    constexpr int size = 201;
+    DijkstraMap map(size, size, DistanceType::Manhattan);
+    CoordList goals = {{1, 1}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, mazeWalkable);
+        benchmark::DoNotOptimize(map.getDistance(size - 2, size - 2));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(MazeFloodFill);
+
+// Benchmark: Perfect maze, Dijkstra over a prebuilt corridor graph
+static void MazeFromCorridorGraph(benchmark::State& state) {
+    constexpr int size = 201;
+    DijkstraMap map(size, size, DistanceType::Manhattan);
+    CorridorGraph graph = buildCorridorGraph(size, size, mazeWalkable, DistanceType::Manhattan);
+    CoordList goals = {{1, 1}};
+
+    for (auto _ : state) {
+        generateDijkstraMapFromCorridorGraph(map, graph, goals);
+        benchmark::DoNotOptimize(map.getDistance(size - 2, size - 2));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(MazeFromCorridorGraph);
+
+// Benchmark: Perfect maze, corner to corner A* with the metric heuristic
+static void MazeAStar(benchmark::State& state) {
+    constexpr int size = 201;
+    SearchWorkspace workspace(size, size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryDistance(workspace, {1, 1}, {size - 2, size - 2}, mazeWalkable,
+                                               DistanceType::Manhattan));
+    }
+}
+BENCHMARK(MazeAStar);
+
+// Benchmark: Perfect maze, corner to corner A* with eight landmarks
+static void MazeAStarLandmarks(benchmark::State& state) {
+    constexpr int size = 201;
+    SearchWorkspace workspace(size, size);
+    LandmarkIndex landmarks = buildLandmarkIndex(size, size, 8, mazeWalkable, DistanceType::Manhattan);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryDistance(workspace, landmarks, {1, 1}, {size - 2, size - 2}, mazeWalkable));
+    }
+}
+BENCHMARK(MazeAStarLandmarks);
+
+// Benchmark: Full map of a large world
+static void LargeWorldFullMap(benchmark::State& state) {
+    constexpr int size = 1024;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, scatteredWalls);
+        benchmark::DoNotOptimize(map.getDistance(900, 900));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(LargeWorldFullMap)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Abstract query on a prebuilt chunk hierarchy, then one refined chunk
+static void LargeWorldHierarchical(benchmark::State& state) {
+    constexpr int size = 1024;
+    ChunkHierarchy hierarchy = buildChunkHierarchy(size, size, 32, scatteredWalls, DistanceType::Octile);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        HierarchicalDijkstraMap map = generateHierarchicalDijkstraMap(hierarchy, goals, scatteredWalls);
+        benchmark::DoNotOptimize(getHierarchicalDistance(map, hierarchy, 900, 900, scatteredWalls));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(LargeWorldHierarchical)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Distance between two tiles read from a full map
+static void PointQueryFullMap(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, scatteredWalls);
+        benchmark::DoNotOptimize(map.getDistance(90, 70));
+    }
+}
+BENCHMARK(PointQueryFullMap);
+
+// Benchmark: Distance between two tiles from an A* query
+static void PointQueryAStar(benchmark::State& state) {
+    constexpr int size = 256;
+    SearchWorkspace workspace(size, size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryDistance(workspace, {90, 70}, {50, 50}, scatteredWalls, DistanceType::Octile));
+    }
+}
+BENCHMARK(PointQueryAStar);
+
+// Benchmark: Long query answered by generating the whole map first
+template<bool (*Walkable)(int, int)>
+static void LongQueryFullMap(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, Walkable);
+        benchmark::DoNotOptimize(map.getDistance(200, 210));
+    }
+}
+BENCHMARK_TEMPLATE(LongQueryFullMap, allWalkable);
+BENCHMARK_TEMPLATE(LongQueryFullMap, scatteredWalls);
+
+// Benchmark: Long query with plain A*
+template<bool (*Walkable)(int, int)>
+static void LongQueryAStar(benchmark::State& state) {
+    constexpr int size = 256;
+    SearchWorkspace workspace(size, size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryDistance(workspace, {200, 210}, {50, 50}, Walkable, DistanceType::Octile));
+    }
+}
+BENCHMARK_TEMPLATE(LongQueryAStar, allWalkable);
+BENCHMARK_TEMPLATE(LongQueryAStar, scatteredWalls);
+
+// Benchmark: Long query with jump point search
+template<bool (*Walkable)(int, int)>
+static void LongQueryJumpPoints(benchmark::State& state) {
+    constexpr int size = 256;
+    SearchWorkspace workspace(size, size);
+    JumpPointGrid grid = buildJumpPointGrid(size, size, Walkable, DistanceType::Octile);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryDistance(workspace, grid, {200, 210}, {50, 50}));
+    }
+}
+BENCHMARK_TEMPLATE(LongQueryJumpPoints, allWalkable);
+BENCHMARK_TEMPLATE(LongQueryJumpPoints, scatteredWalls);
+
+// Benchmark: Contraction hierarchy preprocessing on a 4-connected cave
+static void ContractionHierarchyBuild(benchmark::State& state) {
+    constexpr int size = 256;
+
+    for (auto _ : state) {
+        ContractionHierarchy hierarchy = buildContractionHierarchy(size, size, scatteredWalls, DistanceType::Manhattan);
+        benchmark::DoNotOptimize(hierarchy.getEdgeCount());
+    }
+}
+BENCHMARK(ContractionHierarchyBuild)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Long 4-connected query with plain A*, for comparison with the hierarchy
+static void LongManhattanQueryAStar(benchmark::State& state) {
+    constexpr int size = 256;
+    SearchWorkspace workspace(size, size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryDistance(workspace, {200, 210}, {50, 50}, scatteredWalls, DistanceType::Manhattan));
+    }
+}
+BENCHMARK(LongManhattanQueryAStar);
+
+// Benchmark: Long 4-connected query on a prebuilt contraction hierarchy
+static void LongManhattanQueryContractionHierarchy(benchmark::State& state) {
+    constexpr int size = 256;
+    SearchWorkspace forward(size, size);
+    SearchWorkspace backward(size, size);
+    ContractionHierarchy hierarchy = buildContractionHierarchy(size, size, scatteredWalls, DistanceType::Manhattan);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queryDistance(forward, backward, hierarchy, {200, 210}, {50, 50}));
+    }
+}
+BENCHMARK(LongManhattanQueryContractionHierarchy);
+
+// Benchmark: First-move tables for a small cave, one Dijkstra map per tile
+static void PathDatabaseBuild(benchmark::State& state) {
+    constexpr int size = 64;
+
+    for (auto _ : state) {
+        PathDatabase database = buildPathDatabase(size, size, scatteredWalls, DistanceType::Octile);
+        benchmark::DoNotOptimize(database.getRunCount());
+    }
+}
+BENCHMARK(PathDatabaseBuild)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Path across a small cave with A*
+static void SmallCavePathAStar(benchmark::State& state) {
+    constexpr int size = 64;
+    SearchWorkspace workspace(size, size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(findPath(workspace, {60, 61}, {5, 5}, scatteredWalls, DistanceType::Octile));
+    }
+}
+BENCHMARK(SmallCavePathAStar);
+
+// Benchmark: Same path followed through first-move tables
+static void SmallCavePathDatabase(benchmark::State& state) {
+    constexpr int size = 64;
+    PathDatabase database = buildPathDatabase(size, size, scatteredWalls, DistanceType::Octile);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(extractPath(database, {60, 61}, {5, 5}));
+    }
+}
+BENCHMARK(SmallCavePathDatabase);
+
+// 24 points of interest in the middle of a 256x256 cave
+static CoordList pointsOfInterest() {
+    CoordList points;
+    for (int i = 0; i < 24; ++i) {
+        const int x = 70 + (i * 37) % 110;
+        const int y = 70 + (i * 53) % 110;
+        points.emplace_back(scatteredWalls(x, y) ? x : x + 1, y);
+    }
+    return points;
+}
+
+// Benchmark: Distance matrix from one full map generation per point
+static void DistanceMatrixFullMaps(benchmark::State& state) {
+    constexpr int size = 256;
+    const CoordList points = pointsOfInterest();
+    DijkstraMap map(size, size, DistanceType::Octile);
+
+    for (auto _ : state) {
+        DistanceMatrix matrix(24, 24);
+        for (int source = 0; source < 24; ++source) {
+            generateDijkstraMap(map, {points[source]}, scatteredWalls);
+            for (int target = 0; target < 24; ++target) {
+                const auto [x, y] = points[target];
+                matrix.setDistance(source, target, map.getDistance(x, y));
+            }
+        }
+        benchmark::DoNotOptimize(matrix.getDistance(3, 5));
+    }
+}
+BENCHMARK(DistanceMatrixFullMaps)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Distance matrix with searches that stop once every point is settled
+static void DistanceMatrixEarlyExit(benchmark::State& state) {
+    constexpr int size = 256;
+    const CoordList points = pointsOfInterest();
+
+    for (auto _ : state) {
+        DistanceMatrix matrix = distanceMatrix(size, size, points, points, scatteredWalls, DistanceType::Octile);
+        benchmark::DoNotOptimize(matrix.getDistance(3, 5));
+    }
+}
+BENCHMARK(DistanceMatrixEarlyExit)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Nearest of 8 goals, for comparison with the K-nearest maps
+static void EightGoalsNearest(benchmark::State& state) {
+    constexpr int size = 256;
+    const CoordList points = pointsOfInterest();
+    const CoordList goals(points.begin(), points.begin() + 8);
+    DijkstraMap map(size, size, DistanceType::Octile);
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, scatteredWalls);
+        benchmark::DoNotOptimize(map.getDistance(200, 210));
+    }
+}
+BENCHMARK(EightGoalsNearest)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Two nearest of 8 goals from one separate map per goal
+static void EightGoalsTwoNearestSeparateMaps(benchmark::State& state) {
+    constexpr int size = 256;
+    const CoordList points = pointsOfInterest();
+    std::vector<DijkstraMap> maps(8, DijkstraMap(size, size, DistanceType::Octile));
+
+    for (auto _ : state) {
+        for (int goal = 0; goal < 8; ++goal) {
+            generateDijkstraMap(maps[goal], {points[goal]}, scatteredWalls);
+        }
+        benchmark::DoNotOptimize(maps[7].getDistance(200, 210));
+    }
+}
+BENCHMARK(EightGoalsTwoNearestSeparateMaps)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Two nearest of 8 goals in one propagation
+static void EightGoalsTwoNearest(benchmark::State& state) {
+    constexpr int size = 256;
+    const CoordList points = pointsOfInterest();
+    const CoordList goals(points.begin(), points.begin() + 8);
+    NearestGoalsMap<2> nearestMap(size, size, DistanceType::Octile);
+
+    for (auto _ : state) {
+        generateNearestGoalsMap(nearestMap, goals, scatteredWalls);
+        benchmark::DoNotOptimize(nearestMap.getDistance(1, 200, 210));
+    }
+}
+BENCHMARK(EightGoalsTwoNearest)->Unit(benchmark::kMillisecond);
+
+// Benchmark: Spawn ring found by reading every distance through getDistance
+static void RingScanGetDistance(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (auto _ : state) {
+        CoordList ring;
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                const int distance = map.getDistance(x, y);
+                if (distance >= 50000 && distance <= 51000) {
+                    ring.emplace_back(x, y);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(ring.data());
+    }
+}
+BENCHMARK(RingScanGetDistance);
+
+// Benchmark: Spawn ring found by a vectorized scan of the map storage
+static void RingBandScan(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (auto _ : state) {
+        CoordList ring = findTilesInBand(map, 50000, 51000);
+        benchmark::DoNotOptimize(ring.data());
+    }
+}
+BENCHMARK(RingBandScan);
+
+// Benchmark: Spawn ring read from the settle order recorded during generation
+static void RingSettleOrder(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    SettleOrder settleOrder(size, size);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls, settleOrder);
+
+    for (auto _ : state) {
+        CoordList ring = findTilesInBand(settleOrder, 50000, 51000);
+        benchmark::DoNotOptimize(ring.data());
+    }
+}
+BENCHMARK(RingSettleOrder);
+
+// Benchmark: Generation that also records the settle order
+static void LongQueryFullMapWithSettleOrder(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    SettleOrder settleOrder(size, size);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, scatteredWalls, settleOrder);
+        benchmark::DoNotOptimize(map.getDistance(200, 210));
+    }
+}
+BENCHMARK(LongQueryFullMapWithSettleOrder);
+
+// Benchmark: Ten farthest tiles found by reading every distance through getDistance
+static void FarthestTilesScan(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (auto _ : state) {
+        std::vector<std::tuple<int, int>> tiles;
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                if (map.isReachable(x, y)) {
+                    tiles.emplace_back(-map.getDistance(x, y), y * size + x);
+                }
+            }
+        }
+        std::partial_sort(tiles.begin(), tiles.begin() + 10, tiles.end());
+        benchmark::DoNotOptimize(tiles.data());
+    }
+}
+BENCHMARK(FarthestTilesScan);
+
+// Benchmark: Ten farthest tiles from row maxima of the map storage
+static void FarthestTiles(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (auto _ : state) {
+        CoordList farthest = findFarthestTiles(map, 10);
+        benchmark::DoNotOptimize(farthest.data());
+    }
+}
+BENCHMARK(FarthestTiles);
+
+// Benchmark: Ten farthest tiles read from the end of the settle order
+static void FarthestTilesSettleOrder(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    SettleOrder settleOrder(size, size);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls, settleOrder);
+
+    for (auto _ : state) {
+        CoordList farthest = findFarthestTiles(settleOrder, 10);
+        benchmark::DoNotOptimize(farthest.data());
+    }
+}
+BENCHMARK(FarthestTilesSettleOrder);
+
+// Benchmark: Histogram of distances in buckets of ten straight steps
+static void DistanceHistogram(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (auto _ : state) {
+        std::vector<int> histogram = computeDistanceHistogram(map, 10000);
+        benchmark::DoNotOptimize(histogram.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(DistanceHistogram);
+
+// Benchmark: Flow field built by reading every neighbor through getDistance
+static void FlowFieldScan(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+    const CoordList directions = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+    for (auto _ : state) {
+        FlowField field(size, size, DistanceType::Octile);
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                if (!map.isReachable(x, y)) {
+                    continue;
+                }
+                int best = map.getDistance(x, y);
+                for (int direction = 0; direction < 8; ++direction) {
+                    const auto [dx, dy] = directions[direction];
+                    if (map.getDistance(x + dx, y + dy) < best) {
+                        best = map.getDistance(x + dx, y + dy);
+                        field.setDirection(x, y, direction);
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(field.getRow(0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(FlowFieldScan);
+
+// Benchmark: Flow field from vectorized neighbor minima over the map storage, one thread
+static void FlowFieldSingleThread(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (auto _ : state) {
+        FlowField field = generateFlowField(map, 1);
+        benchmark::DoNotOptimize(field.getRow(0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(FlowFieldSingleThread);
+
+// Benchmark: Flow field with row blocks spread over all hardware threads
+static void FlowFieldAllThreads(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (auto _ : state) {
+        FlowField field = generateFlowField(map);
+        benchmark::DoNotOptimize(field.getRow(0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(FlowFieldAllThreads);
+
+// Benchmark: Full-map generation that fills the flow field in the same pass
+static void LongQueryFullMapWithFlowField(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap map(size, size, DistanceType::Octile);
+    FlowField field(size, size, DistanceType::Octile);
+    CoordList goals = {{50, 50}};
+
+    for (auto _ : state) {
+        generateDijkstraMap(map, goals, scatteredWalls, field);
+        benchmark::DoNotOptimize(field.getDirection(200, 210));
+    }
+}
+BENCHMARK(LongQueryFullMapWithFlowField);
+
+// Benchmark: Goal, flee and danger maps summed tile by tile through getDistance
+static void CombineMapsGetDistance(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap goalMap(size, size, DistanceType::Octile);
+    DijkstraMap fleeMap(size, size, DistanceType::Octile);
+    DijkstraMap dangerMap(size, size, DistanceType::Octile);
+    generateDijkstraMap(goalMap, {{50, 50}}, scatteredWalls);
+    generateDijkstraMap(fleeMap, {{200, 210}}, scatteredWalls);
+    generateDijkstraMap(dangerMap, {{128, 128}}, scatteredWalls);
+    DijkstraMap combined(size, size, DistanceType::Octile);
+
+    for (auto _ : state) {
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                if (!goalMap.isReachable(x, y) || !fleeMap.isReachable(x, y) || !dangerMap.isReachable(x, y)) {
+                    combined.setDistance(x, y, DijkstraMap::UNREACHABLE);
+                    continue;
+                }
+                const double sum = goalMap.getDistance(x, y) - 1.2 * fleeMap.getDistance(x, y)
+                                   + 0.5 * dangerMap.getDistance(x, y);
+                combined.setDistance(x, y, static_cast<int>(std::lround(sum)));
+            }
+        }
+        benchmark::DoNotOptimize(combined.getRow(0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(CombineMapsGetDistance);
+
+// Benchmark: The same sum as one vectorized streaming pass over the rows
+static void CombineMaps(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap goalMap(size, size, DistanceType::Octile);
+    DijkstraMap fleeMap(size, size, DistanceType::Octile);
+    DijkstraMap dangerMap(size, size, DistanceType::Octile);
+    generateDijkstraMap(goalMap, {{50, 50}}, scatteredWalls);
+    generateDijkstraMap(fleeMap, {{200, 210}}, scatteredWalls);
+    generateDijkstraMap(dangerMap, {{128, 128}}, scatteredWalls);
+    DijkstraMap combined(size, size, DistanceType::Octile);
+
+    for (auto _ : state) {
+        combineMaps(combined, {{goalMap, 1.0}, {fleeMap, -1.2}, {dangerMap, 0.5}});
+        benchmark::DoNotOptimize(combined.getRow(0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(CombineMaps);
+
+// Benchmark: The same sum evaluated lazily at 24 agent positions
+static void CombinedMapViewQueries(benchmark::State& state) {
+    constexpr int size = 256;
+    DijkstraMap goalMap(size, size, DistanceType::Octile);
+    DijkstraMap fleeMap(size, size, DistanceType::Octile);
+    DijkstraMap dangerMap(size, size, DistanceType::Octile);
+    generateDijkstraMap(goalMap, {{50, 50}}, scatteredWalls);
+    generateDijkstraMap(fleeMap, {{200, 210}}, scatteredWalls);
+    generateDijkstraMap(dangerMap, {{128, 128}}, scatteredWalls);
+    const CoordList agents = pointsOfInterest();
+
+    for (auto _ : state) {
+        const CombinedMapView view({{goalMap, 1.0}, {fleeMap, -1.2}, {dangerMap, 0.5}});
+        int total = 0;
+        for (const auto& [x, y] : agents) {
+            const int distance = view.getDistance(x, y);
+            total += (distance != DijkstraMap::UNREACHABLE) ? distance : 0;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+BENCHMARK(CombinedMapViewQueries);
+
+// Benchmark: Influence of 24 sources from one full Dijkstra map each, then a reduction
+static void InfluencePerSourceMaps(benchmark::State& state) {
+    constexpr int size = 256;
+    const CoordList sources = pointsOfInterest();
+    DijkstraMap map(size, size, DistanceType::Octile);
+    std::vector<float> influence(size * size);
+
+    for (auto _ : state) {
+        std::fill(influence.begin(), influence.end(), 0.0f);
+        for (const Coord& source : sources) {
+            generateDijkstraMap(map, {source}, scatteredWalls);
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    const int distance = map.getDistance(x, y);
+                    if (distance <= 20000) {
+                        influence[y * size + x] += std::exp2(-distance / 5000.0f);
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(influence.data());
+    }
+}
+BENCHMARK(InfluencePerSourceMaps)->Unit(benchmark::kMillisecond);
+
+// Benchmark: The same influence propagated directly with a cutoff, one thread
+static void InfluenceMapSingleThread(benchmark::State& state) {
+    constexpr int size = 256;
+    std::vector<InfluenceSource> sources;
+    for (const auto& [x, y] : pointsOfInterest()) {
+        sources.push_back({x, y, 1.0});
+    }
+    InfluenceMap influenceMap(size, size, DistanceType::Octile);
+    const InfluenceFalloff falloff{FalloffType::Exponential, 20000, 5000.0};
+
+    for (auto _ : state) {
+        generateInfluenceMap(influenceMap, sources, scatteredWalls, falloff, 1);
+        benchmark::DoNotOptimize(influenceMap.getRow(0));
+    }
+}
+BENCHMARK(InfluenceMapSingleThread)->Unit(benchmark::kMillisecond);
+
+// Benchmark: The same influence with sources and row blocks spread over all hardware threads
+static void InfluenceMapAllThreads(benchmark::State& state) {
+    constexpr int size = 256;
+    std::vector<InfluenceSource> sources;
+    for (const auto& [x, y] : pointsOfInterest()) {
+        sources.push_back({x, y, 1.0});
+    }
+    InfluenceMap influenceMap(size, size, DistanceType::Octile);
+    const InfluenceFalloff falloff{FalloffType::Exponential, 20000, 5000.0};
+
+    for (auto _ : state) {
+        generateInfluenceMap(influenceMap, sources, scatteredWalls, falloff);
+        benchmark::DoNotOptimize(influenceMap.getRow(0));
+    }
+}
+BENCHMARK(InfluenceMapAllThreads)->Unit(benchmark::kMillisecond);
+
 // Benchmark: Map clearing
 static void MapClear(benchmark::State& state) {
     constexpr int size = 100;
@@ -182,6 +1039,128 @@ static void FindUnreachableTiles(benchmark::State& state) {
 }
 BENCHMARK(FindUnreachableTiles);
 
+// Benchmark: Reachability-only flood fill on a prebuilt walkability grid
+static void ComputeReachable(benchmark::State& state) {
+    constexpr int size = 100;
+
+    // Walkable with a vertical wall in the middle
+    auto walkableWithWall = [](int x, int) {
+        return x != 50;
+    };
+
+    BitGrid walkable = buildWalkabilityGrid(size, size, walkableWithWall);
+    CoordList goals = {{25, 50}};
+
+    for (auto _ : state) {
+        BitGrid reachable = computeReachable(walkable, goals);
+        benchmark::DoNotOptimize(reachable.get(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(ComputeReachable);
+
+// Benchmark: Reachability flood fill including packing the walkability function
+static void ComputeReachableFromWalkableFunc(benchmark::State& state) {
+    constexpr int size = 100;
+
+    auto walkableWithWall = [](int x, int) {
+        return x != 50;
+    };
+
+    CoordList goals = {{25, 50}};
+
+    for (auto _ : state) {
+        BitGrid reachable = computeReachable(size, size, goals, walkableWithWall);
+        benchmark::DoNotOptimize(reachable.get(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(ComputeReachableFromWalkableFunc);
+
+// Sources spread over a 100x100 map for per-source generation benchmarks
+static CoordList spreadSources(int count) {
+    CoordList sources;
+    for (int i = 0; i < count; ++i) {
+        sources.emplace_back((i * 37) % 100, (i * 53) % 100);
+    }
+    return sources;
+}
+
+// Benchmark: 64 per-source maps, one generateDijkstraMap call each
+static void PerSourceSeparateGenerations(benchmark::State& state) {
+    constexpr int size = 100;
+    const CoordList sources = spreadSources(64);
+    std::vector<DijkstraMap> maps(sources.size(), DijkstraMap(size, size, DistanceType::Manhattan));
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            generateDijkstraMap(maps[i], {sources[i]}, allWalkable);
+        }
+        benchmark::DoNotOptimize(maps.back().getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size * 64);
+}
+BENCHMARK(PerSourceSeparateGenerations);
+
+// Benchmark: 64 per-source maps from one bit-parallel BFS
+static void PerSourceBitParallel(benchmark::State& state) {
+    constexpr int size = 100;
+    const CoordList sources = spreadSources(64);
+
+    for (auto _ : state) {
+        auto maps = generatePerSourceDijkstraMaps(size, size, sources, allWalkable, DistanceType::Manhattan);
+        benchmark::DoNotOptimize(maps.back().getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size * 64);
+}
+BENCHMARK(PerSourceBitParallel);
+
+// Goal sets for four overlapping maps (factions, resources, threats)
+static std::array<CoordList, 4> channelGoals() {
+    return {
+        CoordList{{10, 10}},
+        CoordList{{90, 90}, {50, 50}},
+        CoordList{{10, 90}},
+        CoordList{{90, 10}, {30, 70}, {70, 30}}
+    };
+}
+
+// Benchmark: Four maps regenerated separately
+static void FourSeparateMaps(benchmark::State& state) {
+    constexpr int size = 100;
+    const auto goals = channelGoals();
+    std::vector<DijkstraMap> maps(goals.size(), DijkstraMap(size, size, DistanceType::Manhattan));
+
+    for (auto _ : state) {
+        for (std::size_t channel = 0; channel < goals.size(); ++channel) {
+            generateDijkstraMap(maps[channel], goals[channel], allWalkable);
+        }
+        benchmark::DoNotOptimize(maps.back().getDistance(0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size * 4);
+}
+BENCHMARK(FourSeparateMaps);
+
+// Benchmark: Four channels of a MultiDijkstraMap in one traversal
+static void FourChannelMultiMap(benchmark::State& state) {
+    constexpr int size = 100;
+    const auto goals = channelGoals();
+    MultiDijkstraMap<4> map(size, size, DistanceType::Manhattan);
+
+    for (auto _ : state) {
+        generateMultiDijkstraMap(map, goals, allWalkable);
+        benchmark::DoNotOptimize(map.getDistance(3, 0, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size * 4);
+}
+BENCHMARK(FourChannelMultiMap);
+
 // Benchmark: Pathfinding with complex maze (checkerboard obstacles)
 static void ComplexMaze(benchmark::State& state) {
     constexpr int size = 50;
@@ -281,6 +1260,16 @@ static void DistanceCalculationEuclidean(benchmark::State& state) {
 }
 BENCHMARK(DistanceCalculationEuclidean);
 
+static void DistanceCalculationOctile(benchmark::State& state) {
+    DijkstraMap map(10, 10, DistanceType::Octile);
+
+    for (auto _ : state) {
+        int dist = map.calculateDistance(0, 0, 9, 9);
+        benchmark::DoNotOptimize(dist);
+    }
+}
+BENCHMARK(DistanceCalculationOctile);
+
 // Benchmark: Memory access patterns - getDistance calls
 static void GetDistanceAccess(benchmark::State& state) {
     constexpr int size = 100;
@@ -0,0 +1,211 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Bit-packed boolean grid, one bit per tile
+ *
+ * Tiles are stored row by row in 64-bit words; each row starts on a new word.
+ * Bits past the map width in the last word of a row are always zero, so whole
+ * words can be combined with bitwise operations without masking.
+ */
+class BitGrid
+{
+public:
+    using Word = std::uint64_t;
+    static constexpr int BITS_PER_WORD = 64;
+
+private:
+    int width;
+    int height;
+    int wordsPerRow;
+    std::vector<Word> words;
+
+public:
+    /**
+     * @brief Constructor - initializes all bits to false
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     */
+    BitGrid(int mapWidth, int mapHeight)
+        : width(mapWidth)
+        , height(mapHeight)
+        , wordsPerRow((mapWidth + BITS_PER_WORD - 1) / BITS_PER_WORD)
+        , words(static_cast<std::size_t>(wordsPerRow) * mapHeight, 0)
+    {
+    }
+
+    /**
+     * @brief Get the bit at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Bit value, or false if out of bounds
+     */
+    bool get(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return false;
+        }
+        return (getRow(y)[x / BITS_PER_WORD] >> (x % BITS_PER_WORD)) & 1;
+    }
+
+    /**
+     * @brief Set the bit at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param value Bit value to store
+     */
+    void set(int x, int y, bool value = true)
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return;
+        }
+
+        const Word bit = Word{1} << (x % BITS_PER_WORD);
+        Word& word = getRow(y)[x / BITS_PER_WORD];
+        word = value ? (word | bit) : (word & ~bit);
+    }
+
+    /**
+     * @brief Set all bits of a horizontal run of tiles
+     * @param y Row of the run
+     * @param xBegin First X coordinate of the run
+     * @param xEnd One past the last X coordinate of the run
+     */
+    void setSpan(int y, int xBegin, int xEnd)
+    {
+        xBegin = std::max(xBegin, 0);
+        xEnd = std::min(xEnd, width);
+        if (y < 0 || y >= height || xBegin >= xEnd)
+        {
+            return;
+        }
+
+        Word* row = getRow(y);
+        const int lastBit = xEnd - 1;
+        for (int wordIndex = xBegin / BITS_PER_WORD; wordIndex <= lastBit / BITS_PER_WORD; ++wordIndex) {
+            const int firstInWord = std::max(xBegin - wordIndex * BITS_PER_WORD, 0);
+            const int lastInWord = std::min(lastBit - wordIndex * BITS_PER_WORD, BITS_PER_WORD - 1);
+            const Word upperBits = ~Word{0} << firstInWord;
+            const Word lowerBits = ~Word{0} >> (BITS_PER_WORD - 1 - lastInWord);
+            row[wordIndex] |= upperBits & lowerBits;
+        }
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the number of words storing one row
+     * @return Words per row
+     */
+    int getWordsPerRow() const
+    {
+        return wordsPerRow;
+    }
+
+    /**
+     * @brief Get the valid-bit mask of the last word in each row
+     * @return Mask with one bit set per in-bounds tile of the last word
+     */
+    Word getLastWordMask() const
+    {
+        const int usedBits = width - (wordsPerRow - 1) * BITS_PER_WORD;
+        return (usedBits >= BITS_PER_WORD) ? ~Word{0} : ((Word{1} << usedBits) - 1);
+    }
+
+    /**
+     * @brief Count the set bits of a word (SWAR popcount)
+     * @param word Word to count
+     * @return Number of set bits
+     */
+    static int countBits(Word word)
+    {
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+    }
+
+    /**
+     * @brief Get the words of a row
+     * @param y Row index, must be within bounds
+     * @return Pointer to the first word of the row
+     */
+    Word* getRow(int y)
+    {
+        return words.data() + static_cast<std::size_t>(y) * wordsPerRow;
+    }
+
+    /**
+     * @brief Get the words of a row
+     * @param y Row index, must be within bounds
+     * @return Pointer to the first word of the row
+     */
+    const Word* getRow(int y) const
+    {
+        return words.data() + static_cast<std::size_t>(y) * wordsPerRow;
+    }
+
+    /**
+     * @brief Count the set bits
+     * @return Number of tiles whose bit is true
+     */
+    int count() const
+    {
+        int total = 0;
+        for (Word word : words) {
+            total += countBits(word);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Clear the grid - reset all bits to false
+     */
+    void clear()
+    {
+        std::fill(words.begin(), words.end(), 0);
+    }
+
+    /**
+     * @brief Compare two grids bit by bit
+     * @param other Grid to compare with
+     * @return True if dimensions and all bits match
+     */
+    bool operator==(const BitGrid& other) const
+    {
+        return width == other.width && height == other.height && words == other.words;
+    }
+
+    /**
+     * @brief Compare two grids bit by bit
+     * @param other Grid to compare with
+     * @return True if dimensions or any bit differ
+     */
+    bool operator!=(const BitGrid& other) const
+    {
+        return !(*this == other);
+    }
+};
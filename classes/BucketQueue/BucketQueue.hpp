@@ -0,0 +1,91 @@
+#pragma once
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Monotone bucket priority queue for small integer edge costs (Dial's algorithm)
+ *
+ * Entries are tile indices keyed by distance. Buckets form a ring of
+ * maxStepCost + 1 slots, so every pushed distance must lie within
+ * [current distance, current distance + maxStepCost]; that holds for
+ * Dijkstra with non-negative step costs up to maxStepCost. Push and pop are
+ * amortized O(1).
+ */
+class BucketQueue
+{
+private:
+    std::vector<std::vector<int>> buckets;
+    int currentDistance;
+    std::size_t entryCount;
+
+public:
+    /**
+     * @brief Constructor - creates an empty queue
+     * @param maxStepCost Largest cost of a single step
+     */
+    explicit BucketQueue(int maxStepCost)
+        : buckets(static_cast<std::size_t>(maxStepCost) + 1)
+        , currentDistance(0)
+        , entryCount(0)
+    {
+    }
+
+    /**
+     * @brief Add an entry
+     * @param distance Key of the entry, within maxStepCost of the current distance
+     * @param index Tile index of the entry
+     */
+    void push(int distance, int index)
+    {
+        buckets[static_cast<std::size_t>(distance) % buckets.size()].push_back(index);
+        ++entryCount;
+    }
+
+    /**
+     * @brief Remove an entry with the smallest distance
+     * @return Tuple of (distance, tile index); the queue must not be empty
+     */
+    std::tuple<int, int> pop()
+    {
+        std::vector<int>* bucket = &buckets[static_cast<std::size_t>(currentDistance) % buckets.size()];
+        while (bucket->empty()) {
+            ++currentDistance;
+            bucket = &buckets[static_cast<std::size_t>(currentDistance) % buckets.size()];
+        }
+
+        const int index = bucket->back();
+        bucket->pop_back();
+        --entryCount;
+        return std::make_tuple(currentDistance, index);
+    }
+
+    /**
+     * @brief Check if the queue holds no entries
+     * @return True if empty
+     */
+    bool empty() const
+    {
+        return entryCount == 0;
+    }
+
+    /**
+     * @brief Get the number of entries
+     * @return Entry count
+     */
+    std::size_t size() const
+    {
+        return entryCount;
+    }
+
+    /**
+     * @brief Remove all entries and restart at distance 0
+     */
+    void clear()
+    {
+        for (auto& bucket : buckets) {
+            bucket.clear();
+        }
+        currentDistance = 0;
+        entryCount = 0;
+    }
+};
@@ -0,0 +1,342 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Abstract graph over fixed-size chunks of a grid (HPA*-style)
+ *
+ * Each pair of neighboring chunks is joined by crossings: pairs of adjacent
+ * walkable tiles on either side of their shared border. With diagonal
+ * movement, tiles that touch only diagonally also get a crossing, along a
+ * border or at the corner shared by four chunks, so chunks meeting only at a
+ * corner stay connected. The crossing tiles of a chunk are its entrances,
+ * ordered north, south, west, east, northwest, southeast, northeast,
+ * southwest, and each chunk stores the in-chunk distances between all of its
+ * entrances.
+ */
+class ChunkHierarchy
+{
+public:
+    /**
+     * @brief Pair of adjacent walkable tiles across a chunk border
+     */
+    struct Crossing
+    {
+        int x;       // Tile in the west or north chunk
+        int y;
+        int otherX;  // Tile in the east or south chunk
+        int otherY;
+    };
+
+    // Entrance groups of a chunk: north, south, west, east, northwest, southeast, northeast, southwest
+    static constexpr int ENTRANCE_GROUP_COUNT = 8;
+
+private:
+    int width;
+    int height;
+    int chunkSize;
+    int chunksX;
+    int chunksY;
+    DistanceType distanceType;
+    std::vector<std::vector<Crossing>> eastCrossings;
+    std::vector<std::vector<Crossing>> southCrossings;
+    std::vector<std::vector<Crossing>> southEastCrossings;
+    std::vector<std::vector<Crossing>> southWestCrossings;
+    std::vector<std::vector<int>> distanceTables;
+
+    /**
+     * @brief Get the crossings of a chunk from one of the crossing lists
+     * @param crossings Crossing list to read
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Crossings of the chunk, or an empty list if the chunk does not exist
+     */
+    const std::vector<Crossing>& getChunkCrossings(const std::vector<std::vector<Crossing>>& crossings,
+                                                   int chunkX,
+                                                   int chunkY) const
+    {
+        static const std::vector<Crossing> none;
+        return isChunkWithinBounds(chunkX, chunkY) ? crossings[getChunkIndex(chunkX, chunkY)] : none;
+    }
+
+    /**
+     * @brief Get the crossings behind each entrance group of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Per group, in entrance order, the crossings and whether the chunk holds their other tile
+     */
+    std::array<std::pair<const std::vector<Crossing>*, bool>, ENTRANCE_GROUP_COUNT> getEntranceGroups(int chunkX,
+                                                                                                        int chunkY) const
+    {
+        return {{
+            {&getChunkCrossings(southCrossings, chunkX, chunkY - 1), true},
+            {&getChunkCrossings(southCrossings, chunkX, chunkY), false},
+            {&getChunkCrossings(eastCrossings, chunkX - 1, chunkY), true},
+            {&getChunkCrossings(eastCrossings, chunkX, chunkY), false},
+            {&getChunkCrossings(southEastCrossings, chunkX - 1, chunkY - 1), true},
+            {&getChunkCrossings(southEastCrossings, chunkX, chunkY), false},
+            {&getChunkCrossings(southWestCrossings, chunkX + 1, chunkY - 1), true},
+            {&getChunkCrossings(southWestCrossings, chunkX, chunkY), false}
+        }};
+    }
+
+public:
+    /**
+     * @brief Constructor - creates a hierarchy without crossings
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param chunkTiles Width and height of a chunk in tiles, clamped to at least 1
+     * @param distType Distance type selecting connectivity and step costs
+     */
+    ChunkHierarchy(int mapWidth, int mapHeight, int chunkTiles, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , chunkSize(std::max(1, chunkTiles))
+        , chunksX((mapWidth + chunkSize - 1) / chunkSize)
+        , chunksY((mapHeight + chunkSize - 1) / chunkSize)
+        , distanceType(distType)
+        , eastCrossings(static_cast<std::size_t>(chunksX) * chunksY)
+        , southCrossings(static_cast<std::size_t>(chunksX) * chunksY)
+        , southEastCrossings(static_cast<std::size_t>(chunksX) * chunksY)
+        , southWestCrossings(static_cast<std::size_t>(chunksX) * chunksY)
+        , distanceTables(static_cast<std::size_t>(chunksX) * chunksY)
+    {
+    }
+
+    /**
+     * @brief Get the crossings of a chunk's east border
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Crossings into the chunk to the east
+     */
+    const std::vector<Crossing>& getEastCrossings(int chunkX, int chunkY) const
+    {
+        return eastCrossings[getChunkIndex(chunkX, chunkY)];
+    }
+
+    /**
+     * @brief Get the crossings of a chunk's south border
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Crossings into the chunk to the south
+     */
+    const std::vector<Crossing>& getSouthCrossings(int chunkX, int chunkY) const
+    {
+        return southCrossings[getChunkIndex(chunkX, chunkY)];
+    }
+
+    /**
+     * @brief Set the crossings of a chunk's east border
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param crossings Crossings into the chunk to the east
+     */
+    void setEastCrossings(int chunkX, int chunkY, std::vector<Crossing> crossings)
+    {
+        eastCrossings[getChunkIndex(chunkX, chunkY)] = std::move(crossings);
+    }
+
+    /**
+     * @brief Set the crossings of a chunk's south border
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param crossings Crossings into the chunk to the south
+     */
+    void setSouthCrossings(int chunkX, int chunkY, std::vector<Crossing> crossings)
+    {
+        southCrossings[getChunkIndex(chunkX, chunkY)] = std::move(crossings);
+    }
+
+    /**
+     * @brief Get the crossings at a chunk's southeast corner
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Diagonal crossings into the chunk to the southeast
+     */
+    const std::vector<Crossing>& getSouthEastCrossings(int chunkX, int chunkY) const
+    {
+        return southEastCrossings[getChunkIndex(chunkX, chunkY)];
+    }
+
+    /**
+     * @brief Get the crossings at a chunk's southwest corner
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Diagonal crossings into the chunk to the southwest
+     */
+    const std::vector<Crossing>& getSouthWestCrossings(int chunkX, int chunkY) const
+    {
+        return southWestCrossings[getChunkIndex(chunkX, chunkY)];
+    }
+
+    /**
+     * @brief Set the crossings at a chunk's southeast corner
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param crossings Diagonal crossings into the chunk to the southeast
+     */
+    void setSouthEastCrossings(int chunkX, int chunkY, std::vector<Crossing> crossings)
+    {
+        southEastCrossings[getChunkIndex(chunkX, chunkY)] = std::move(crossings);
+    }
+
+    /**
+     * @brief Set the crossings at a chunk's southwest corner
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param crossings Diagonal crossings into the chunk to the southwest
+     */
+    void setSouthWestCrossings(int chunkX, int chunkY, std::vector<Crossing> crossings)
+    {
+        southWestCrossings[getChunkIndex(chunkX, chunkY)] = std::move(crossings);
+    }
+
+    /**
+     * @brief Get the entrance tiles of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Entrance tiles as (x, y), ordered north, south, west, east, northwest, southeast, northeast, southwest
+     */
+    std::vector<std::tuple<int, int>> getEntrances(int chunkX, int chunkY) const
+    {
+        std::vector<std::tuple<int, int>> entrances;
+        for (const auto& [crossings, isOtherTile] : getEntranceGroups(chunkX, chunkY))
+        {
+            for (const Crossing& crossing : *crossings) {
+                if (isOtherTile)
+                {
+                    entrances.emplace_back(crossing.otherX, crossing.otherY);
+                }
+                else
+                {
+                    entrances.emplace_back(crossing.x, crossing.y);
+                }
+            }
+        }
+        return entrances;
+    }
+
+    /**
+     * @brief Get the index of the first entrance of each entrance group of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Offsets of the groups in entrance order, followed by the entrance count
+     */
+    std::array<int, ENTRANCE_GROUP_COUNT + 1> getEntranceOffsets(int chunkX, int chunkY) const
+    {
+        std::array<int, ENTRANCE_GROUP_COUNT + 1> offsets = {};
+        const auto groups = getEntranceGroups(chunkX, chunkY);
+        for (int group = 0; group < ENTRANCE_GROUP_COUNT; ++group) {
+            offsets[group + 1] = offsets[group] + static_cast<int>(groups[group].first->size());
+        }
+        return offsets;
+    }
+
+    /**
+     * @brief Get the number of entrances of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Entrance count over all borders and corners
+     */
+    int getEntranceCount(int chunkX, int chunkY) const
+    {
+        return getEntranceOffsets(chunkX, chunkY)[ENTRANCE_GROUP_COUNT];
+    }
+
+    /**
+     * @brief Get the in-chunk distances between the entrances of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Row-major table, entry [from * entranceCount + to]
+     */
+    const std::vector<int>& getDistanceTable(int chunkX, int chunkY) const
+    {
+        return distanceTables[getChunkIndex(chunkX, chunkY)];
+    }
+
+    /**
+     * @brief Set the in-chunk distances between the entrances of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param table Row-major table, entry [from * entranceCount + to]
+     */
+    void setDistanceTable(int chunkX, int chunkY, std::vector<int> table)
+    {
+        distanceTables[getChunkIndex(chunkX, chunkY)] = std::move(table);
+    }
+
+    /**
+     * @brief Get the tiles covered by a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Tuple of (x, y, width, height); chunks on the map edge may be smaller
+     */
+    std::tuple<int, int, int, int> getChunkBounds(int chunkX, int chunkY) const
+    {
+        const int x = chunkX * chunkSize;
+        const int y = chunkY * chunkSize;
+        return std::make_tuple(x, y, std::min(chunkSize, width - x), std::min(chunkSize, height - y));
+    }
+
+    /**
+     * @brief Get the index of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Row-major chunk index
+     */
+    int getChunkIndex(int chunkX, int chunkY) const
+    {
+        return chunkY * chunksX + chunkX;
+    }
+
+    /**
+     * @brief Check if chunk coordinates are valid
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return True if the chunk exists
+     */
+    bool isChunkWithinBounds(int chunkX, int chunkY) const
+    {
+        return chunkX >= 0 && chunkX < chunksX && chunkY >= 0 && chunkY < chunksY;
+    }
+
+    /**
+     * @brief Get the number of chunks
+     * @return Tuple of (chunk columns, chunk rows)
+     */
+    std::tuple<int, int> getChunkCounts() const
+    {
+        return std::make_tuple(chunksX, chunksY);
+    }
+
+    /**
+     * @brief Get the width and height of a chunk
+     * @return Chunk size in tiles
+     */
+    int getChunkSize() const
+    {
+        return chunkSize;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the distance type the hierarchy was built for
+     * @return The distance type
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+};
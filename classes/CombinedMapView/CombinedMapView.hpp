@@ -0,0 +1,138 @@
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Dijkstra map scaled by a weight, one term of a weighted sum of maps
+ */
+struct WeightedMap
+{
+    const DijkstraMap& map;
+    double weight;
+};
+
+/**
+ * @brief Weighted sum of Dijkstra maps, evaluated only at the tiles queried
+ *
+ * A tile's combined distance is the sum of weight times distance over all
+ * terms, rounded to the nearest integer (ties to even) and saturated to
+ * [LOWEST_DISTANCE, HIGHEST_DISTANCE], so results never collide with
+ * UNREACHABLE. A tile that is UNREACHABLE in any term is UNREACHABLE. The
+ * view stores references; the maps must outlive it.
+ */
+class CombinedMapView
+{
+public:
+    // Use the same infinite distance as DijkstraMap
+    static constexpr int UNREACHABLE = DijkstraMap::UNREACHABLE;
+    // Range combined distances saturate to
+    static constexpr int LOWEST_DISTANCE = std::numeric_limits<int>::min();
+    static constexpr int HIGHEST_DISTANCE = UNREACHABLE - 1;
+
+private:
+    std::vector<WeightedMap> terms;
+
+public:
+    /**
+     * @brief Constructor - combines maps without reading them
+     * @param weightedMaps Terms of the sum; the first one sets the dimensions
+     */
+    explicit CombinedMapView(std::vector<WeightedMap> weightedMaps)
+        : terms(std::move(weightedMaps))
+    {
+    }
+
+    /**
+     * @brief Get the combined distance at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Combined distance, or UNREACHABLE if unreachable in any term or out of bounds
+     */
+    int getDistance(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return UNREACHABLE;
+        }
+
+        double sum = 0.0;
+        for (const WeightedMap& term : terms)
+        {
+            const int distance = term.map.getDistance(x, y);
+            if (distance == UNREACHABLE)
+            {
+                return UNREACHABLE;
+            }
+            sum += term.weight * distance;
+        }
+        return roundDistance(sum);
+    }
+
+    /**
+     * @brief Check if a tile has a combined distance
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if reachable in every term
+     */
+    bool isReachable(int x, int y) const
+    {
+        return getDistance(x, y) != UNREACHABLE;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within the bounds of the first term
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        const auto [width, height] = getDimensions();
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height) of the first term, (0, 0) without terms
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        if (terms.empty())
+        {
+            return std::make_tuple(0, 0);
+        }
+        return terms.front().map.getDimensions();
+    }
+
+    /**
+     * @brief Get the terms of the sum
+     * @return Weighted maps in the order they are added
+     */
+    const std::vector<WeightedMap>& getTerms() const
+    {
+        return terms;
+    }
+
+    /**
+     * @brief Saturate and round a weighted sum to a combined distance
+     *
+     * Rounds by adding and subtracting 1.5 * 2^52, the same as std::nearbyint
+     * in the default rounding mode but vectorizable without SSE4.1. Rounding
+     * before saturating keeps the additions unconditional, which the
+     * vectorizer needs.
+     *
+     * @param sum Weighted sum of distances
+     * @return Nearest integer in [LOWEST_DISTANCE, HIGHEST_DISTANCE]
+     */
+    static int roundDistance(double sum)
+    {
+        constexpr double roundingShift = 6755399441055744.0;
+        const double rounded = (sum + roundingShift) - roundingShift;
+        return static_cast<int>(std::min(static_cast<double>(HIGHEST_DISTANCE),
+                                         std::max(static_cast<double>(LOWEST_DISTANCE), rounded)));
+    }
+};
@@ -0,0 +1,132 @@
+#pragma once
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Connected-component labels over a walkability grid
+ *
+ * Every walkable tile stores the ID of the component it belongs to. Two tiles
+ * with the same ID can reach each other; non-walkable tiles are NO_COMPONENT.
+ * Component IDs are dense, in the range [0, getComponentCount()).
+ */
+class ComponentLabels
+{
+public:
+    // Label of non-walkable and out-of-bounds tiles
+    static constexpr int NO_COMPONENT = -1;
+
+private:
+    int width;
+    int height;
+    std::vector<int> labels;
+    std::vector<int> componentSizes;
+
+public:
+    /**
+     * @brief Constructor - initializes all tiles to NO_COMPONENT
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     */
+    ComponentLabels(int mapWidth, int mapHeight)
+        : width(mapWidth)
+        , height(mapHeight)
+        , labels(static_cast<std::size_t>(mapWidth) * mapHeight, NO_COMPONENT)
+    {
+    }
+
+    /**
+     * @brief Get the component ID at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Component ID, or NO_COMPONENT if not walkable or out of bounds
+     */
+    int getLabel(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return NO_COMPONENT;
+        }
+        return labels[static_cast<std::size_t>(y) * width + x];
+    }
+
+    /**
+     * @brief Set the component ID at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param label Component ID to set
+     */
+    void setLabel(int x, int y, int label)
+    {
+        if (isWithinBounds(x, y))
+        {
+            labels[static_cast<std::size_t>(y) * width + x] = label;
+        }
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Check if two tiles belong to the same component
+     * @param x1 First tile X coordinate
+     * @param y1 First tile Y coordinate
+     * @param x2 Second tile X coordinate
+     * @param y2 Second tile Y coordinate
+     * @return True if both tiles are walkable and connected
+     */
+    bool isSameComponent(int x1, int y1, int x2, int y2) const
+    {
+        const int label = getLabel(x1, y1);
+        return label != NO_COMPONENT && label == getLabel(x2, y2);
+    }
+
+    /**
+     * @brief Get the number of components
+     * @return Component count
+     */
+    int getComponentCount() const
+    {
+        return static_cast<int>(componentSizes.size());
+    }
+
+    /**
+     * @brief Get the number of tiles in a component
+     * @param componentId Component ID
+     * @return Tile count, or 0 for an invalid ID
+     */
+    int getComponentSize(int componentId) const
+    {
+        if (componentId < 0 || componentId >= getComponentCount())
+        {
+            return 0;
+        }
+        return componentSizes[componentId];
+    }
+
+    /**
+     * @brief Set the tile counts of all components
+     * @param sizes Tile count per component ID
+     */
+    void setComponentSizes(std::vector<int> sizes)
+    {
+        componentSizes = std::move(sizes);
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+};
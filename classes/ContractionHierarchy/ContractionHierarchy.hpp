@@ -0,0 +1,354 @@
+#pragma once
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Upward search graph of a contraction hierarchy over a grid
+ *
+ * Every walkable tile is a node; node IDs are contraction ranks, so a node
+ * was contracted before every node with a larger ID. Each node stores, in
+ * compressed sparse rows, the edges to its neighbors of higher rank at the
+ * time it was contracted. An edge is either a grid step or a shortcut that
+ * stands for two edges through its middle node, which has a lower rank than
+ * both ends.
+ */
+class ContractionHierarchy
+{
+public:
+    // Node of non-walkable and out-of-bounds tiles
+    static constexpr int NO_NODE = -1;
+    // Middle node of edges that are single grid steps
+    static constexpr int NO_MIDDLE = -1;
+
+    /**
+     * @brief Edge from a node to a node of higher rank
+     */
+    struct Edge
+    {
+        int target;
+        int weight;
+        int middle;  // Node the shortcut passes through, or NO_MIDDLE
+    };
+
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    std::vector<int> nodeIds;
+    std::vector<int> nodeTiles;
+    std::vector<int> firstEdges;
+    std::vector<Edge> edges;
+
+public:
+    /**
+     * @brief Constructor - creates a hierarchy without nodes
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance type selecting connectivity and step costs
+     */
+    ContractionHierarchy(int mapWidth, int mapHeight, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , nodeIds(static_cast<std::size_t>(mapWidth) * mapHeight, NO_NODE)
+        , firstEdges(1, 0)
+    {
+    }
+
+    /**
+     * @brief Add the node of next rank
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return ID of the new node
+     */
+    int addNode(int x, int y)
+    {
+        const int node = getNodeCount();
+        const int tile = y * width + x;
+        nodeIds[tile] = node;
+        nodeTiles.push_back(tile);
+        firstEdges.push_back(firstEdges.back());
+        return node;
+    }
+
+    /**
+     * @brief Add an upward edge to the most recently added node
+     * @param target Node of higher rank
+     * @param weight Length of the edge
+     * @param middle Middle node of a shortcut, or NO_MIDDLE
+     */
+    void addEdge(int target, int weight, int middle)
+    {
+        edges.push_back({target, weight, middle});
+        ++firstEdges.back();
+    }
+
+    /**
+     * @brief Get the node of a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Node ID, or NO_NODE if not walkable or out of bounds
+     */
+    int getNode(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return NO_NODE;
+        }
+        return nodeIds[static_cast<std::size_t>(y) * width + x];
+    }
+
+    /**
+     * @brief Get the tile of a node
+     * @param node Node ID, must be valid
+     * @return Tuple of (x, y)
+     */
+    std::tuple<int, int> getNodePosition(int node) const
+    {
+        return std::make_tuple(nodeTiles[node] % width, nodeTiles[node] / width);
+    }
+
+    /**
+     * @brief Get the upward edges of a node
+     * @param node Node ID, must be valid
+     * @return Tuple of (first, last) edge indices, last exclusive
+     */
+    std::tuple<int, int> getEdgeRange(int node) const
+    {
+        return std::make_tuple(firstEdges[node], firstEdges[node + 1]);
+    }
+
+    /**
+     * @brief Get an edge
+     * @param edge Edge index, must be valid
+     * @return Edge
+     */
+    const Edge& getEdge(int edge) const
+    {
+        return edges[edge];
+    }
+
+    /**
+     * @brief Find the edge between two nodes
+     * @param first First node ID, must be valid
+     * @param second Second node ID, must be valid
+     * @return Edge index stored at the lower-ranked node, or -1 if the nodes are not adjacent
+     */
+    int findEdge(int first, int second) const
+    {
+        const int lower = (first < second) ? first : second;
+        const int higher = (first < second) ? second : first;
+        for (int edge = firstEdges[lower]; edge < firstEdges[lower + 1]; ++edge)
+        {
+            if (edges[edge].target == higher)
+            {
+                return edge;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Get the number of nodes
+     * @return Node count
+     */
+    int getNodeCount() const
+    {
+        return static_cast<int>(nodeTiles.size());
+    }
+
+    /**
+     * @brief Get the number of upward edges
+     * @return Edge count
+     */
+    int getEdgeCount() const
+    {
+        return static_cast<int>(edges.size());
+    }
+
+    /**
+     * @brief Encode the hierarchy into bytes
+     *
+     * Integers are variable-length (7 bits per byte). Edge targets and middle
+     * nodes are stored relative to their node, so most take one or two bytes.
+     *
+     * @return Encoded hierarchy
+     */
+    std::vector<std::uint8_t> serialize() const
+    {
+        std::vector<std::uint8_t> bytes = {'D', 'M', 'C', 'H', FORMAT_VERSION};
+        writeNumber(bytes, static_cast<std::uint32_t>(width));
+        writeNumber(bytes, static_cast<std::uint32_t>(height));
+        writeNumber(bytes, static_cast<std::uint32_t>(distanceType));
+        writeNumber(bytes, static_cast<std::uint32_t>(getNodeCount()));
+
+        for (int node = 0; node < getNodeCount(); ++node)
+        {
+            writeNumber(bytes, static_cast<std::uint32_t>(nodeTiles[node]));
+            writeNumber(bytes, static_cast<std::uint32_t>(firstEdges[node + 1] - firstEdges[node]));
+            for (int edge = firstEdges[node]; edge < firstEdges[node + 1]; ++edge)
+            {
+                const Edge& current = edges[edge];
+                writeNumber(bytes, static_cast<std::uint32_t>(current.target - node));
+                writeNumber(bytes, static_cast<std::uint32_t>(current.weight));
+                writeNumber(bytes, (current.middle == NO_MIDDLE) ? 0u : static_cast<std::uint32_t>(node - current.middle));
+            }
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Replace the hierarchy with one decoded from bytes
+     * @param bytes Bytes produced by serialize()
+     * @return True on success; false if the bytes are malformed or the map has more than 2^28 tiles,
+     *         leaving the hierarchy unchanged
+     */
+    bool deserialize(const std::vector<std::uint8_t>& bytes)
+    {
+        std::size_t position = 5;
+        if (bytes.size() < position || bytes[0] != 'D' || bytes[1] != 'M' || bytes[2] != 'C' || bytes[3] != 'H' ||
+            bytes[4] != FORMAT_VERSION)
+        {
+            return false;
+        }
+
+        std::uint32_t newWidth = 0;
+        std::uint32_t newHeight = 0;
+        std::uint32_t newDistanceType = 0;
+        std::uint32_t nodeCount = 0;
+        if (!readNumber(bytes, position, newWidth) || !readNumber(bytes, position, newHeight) ||
+            !readNumber(bytes, position, newDistanceType) || !readNumber(bytes, position, nodeCount) ||
+            newDistanceType > static_cast<std::uint32_t>(DistanceType::Octile) ||
+            static_cast<std::uint64_t>(newWidth) * newHeight > MAX_TILE_COUNT || nodeCount > newWidth * newHeight ||
+            nodeCount > (bytes.size() - position) / 2)
+        {
+            return false;
+        }
+
+        ContractionHierarchy decoded(static_cast<int>(newWidth), static_cast<int>(newHeight),
+                                     static_cast<DistanceType>(newDistanceType));
+        for (std::uint32_t node = 0; node < nodeCount; ++node)
+        {
+            std::uint32_t tile = 0;
+            std::uint32_t edgeCount = 0;
+            if (!readNumber(bytes, position, tile) || !readNumber(bytes, position, edgeCount) ||
+                tile >= newWidth * newHeight || decoded.nodeIds[tile] != NO_NODE)
+            {
+                return false;
+            }
+            decoded.addNode(static_cast<int>(tile % newWidth), static_cast<int>(tile / newWidth));
+
+            for (std::uint32_t edge = 0; edge < edgeCount; ++edge)
+            {
+                std::uint32_t targetOffset = 0;
+                std::uint32_t weight = 0;
+                std::uint32_t middleOffset = 0;
+                if (!readNumber(bytes, position, targetOffset) || !readNumber(bytes, position, weight) ||
+                    !readNumber(bytes, position, middleOffset) || targetOffset == 0 ||
+                    targetOffset >= nodeCount - node || middleOffset > node || weight > INT32_MAX)
+                {
+                    return false;
+                }
+                const int target = static_cast<int>(node + targetOffset);
+                const int middle = (middleOffset == 0) ? NO_MIDDLE : static_cast<int>(node - middleOffset);
+
+                // A shortcut unpacks into the middle node's edges to both ends, which are already decoded
+                if (middle != NO_MIDDLE &&
+                    (decoded.findEdge(middle, static_cast<int>(node)) < 0 || decoded.findEdge(middle, target) < 0))
+                {
+                    return false;
+                }
+                decoded.addEdge(target, static_cast<int>(weight), middle);
+            }
+        }
+
+        if (position != bytes.size())
+        {
+            return false;
+        }
+        *this = std::move(decoded);
+        return true;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the distance type the hierarchy was built for
+     * @return Distance type
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+
+private:
+    static constexpr std::uint8_t FORMAT_VERSION = 1;
+    // Largest map deserialize() allocates node IDs for, since the header alone sets the size
+    static constexpr std::uint64_t MAX_TILE_COUNT = std::uint64_t(1) << 28;
+
+    /**
+     * @brief Append a variable-length number
+     * @param bytes Output bytes
+     * @param value Number to write
+     */
+    static void writeNumber(std::vector<std::uint8_t>& bytes, std::uint32_t value)
+    {
+        while (value >= 0x80)
+        {
+            bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    /**
+     * @brief Read a variable-length number
+     * @param bytes Input bytes
+     * @param position Read position, advanced past the number
+     * @param value Number read
+     * @return True on success, false if the bytes end early or the number overflows
+     */
+    static bool readNumber(const std::vector<std::uint8_t>& bytes, std::size_t& position, std::uint32_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 35; shift += 7)
+        {
+            if (position >= bytes.size())
+            {
+                return false;
+            }
+            const std::uint8_t byte = bytes[position++];
+            if (shift == 28 && byte > 0x0F)
+            {
+                return false;
+            }
+            value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
@@ -0,0 +1,298 @@
+#pragma once
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Walkable tiles with 1-wide corridors contracted into weighted chains
+ *
+ * Walkable tiles with exactly two walkable neighbors are corridor tiles; all
+ * other walkable tiles are nodes. Every maximal run of corridor tiles forms a
+ * chain between two nodes (possibly the same one), stored with the distance of
+ * each of its tiles from the first node. Removed nodes and chains leave
+ * inactive slots that are reused by later additions.
+ */
+class CorridorGraph
+{
+public:
+    // ID of tiles that are not a node or not in a chain
+    static constexpr int NO_NODE = -1;
+    static constexpr int NO_CHAIN = -1;
+
+    /**
+     * @brief Run of corridor tiles between two nodes
+     */
+    struct Chain
+    {
+        int firstNode;
+        int lastNode;
+        int length;                // Distance from firstNode to lastNode along the chain
+        std::vector<int> tiles;    // Tile indices (y * width + x), starting next to firstNode
+        std::vector<int> offsets;  // Distance of each tile from firstNode
+    };
+
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    std::vector<int> nodeIds;
+    std::vector<int> chainIds;
+    std::vector<std::tuple<int, int>> nodes;
+    std::vector<bool> activeNodes;
+    std::vector<std::vector<int>> incidentChains;
+    std::vector<Chain> chains;
+    std::vector<bool> activeChains;
+    std::vector<int> freeNodes;
+    std::vector<int> freeChains;
+
+public:
+    /**
+     * @brief Constructor - creates a graph without nodes or chains
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance type selecting connectivity and step costs
+     */
+    CorridorGraph(int mapWidth, int mapHeight, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , nodeIds(static_cast<std::size_t>(mapWidth) * mapHeight, NO_NODE)
+        , chainIds(static_cast<std::size_t>(mapWidth) * mapHeight, NO_CHAIN)
+    {
+    }
+
+    /**
+     * @brief Add a node at a tile
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return ID of the new node
+     */
+    int addNode(int x, int y)
+    {
+        int nodeId = static_cast<int>(nodes.size());
+        if (freeNodes.empty())
+        {
+            nodes.emplace_back(x, y);
+            activeNodes.push_back(true);
+            incidentChains.emplace_back();
+        }
+        else
+        {
+            nodeId = freeNodes.back();
+            freeNodes.pop_back();
+            nodes[nodeId] = std::make_tuple(x, y);
+            activeNodes[nodeId] = true;
+        }
+
+        nodeIds[getIndex(x, y)] = nodeId;
+        return nodeId;
+    }
+
+    /**
+     * @brief Remove a node; its chains must have been removed first
+     * @param nodeId Active node ID
+     */
+    void removeNode(int nodeId)
+    {
+        const auto [x, y] = nodes[nodeId];
+        nodeIds[getIndex(x, y)] = NO_NODE;
+        activeNodes[nodeId] = false;
+        incidentChains[nodeId].clear();
+        freeNodes.push_back(nodeId);
+    }
+
+    /**
+     * @brief Add a chain and assign its tiles to it
+     * @param chain Chain between two active nodes, over tiles not in another chain
+     * @return ID of the new chain
+     */
+    int addChain(Chain chain)
+    {
+        int chainId = static_cast<int>(chains.size());
+        if (freeChains.empty())
+        {
+            chains.push_back(std::move(chain));
+            activeChains.push_back(true);
+        }
+        else
+        {
+            chainId = freeChains.back();
+            freeChains.pop_back();
+            chains[chainId] = std::move(chain);
+            activeChains[chainId] = true;
+        }
+
+        const Chain& added = chains[chainId];
+        for (int tile : added.tiles) {
+            chainIds[tile] = chainId;
+        }
+        incidentChains[added.firstNode].push_back(chainId);
+        if (added.lastNode != added.firstNode)
+        {
+            incidentChains[added.lastNode].push_back(chainId);
+        }
+        return chainId;
+    }
+
+    /**
+     * @brief Remove a chain and release its tiles
+     * @param chainId Active chain ID
+     */
+    void removeChain(int chainId)
+    {
+        Chain& chain = chains[chainId];
+        for (int tile : chain.tiles) {
+            chainIds[tile] = NO_CHAIN;
+        }
+        for (int nodeId : {chain.firstNode, chain.lastNode}) {
+            auto& incident = incidentChains[nodeId];
+            incident.erase(std::remove(incident.begin(), incident.end(), chainId), incident.end());
+        }
+
+        chain.tiles.clear();
+        chain.offsets.clear();
+        activeChains[chainId] = false;
+        freeChains.push_back(chainId);
+    }
+
+    /**
+     * @brief Get the node at a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Node ID, or NO_NODE if the tile is not a node or out of bounds
+     */
+    int getNodeId(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return NO_NODE;
+        }
+        return nodeIds[getIndex(x, y)];
+    }
+
+    /**
+     * @brief Get the chain containing a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Chain ID, or NO_CHAIN if the tile is not a corridor tile or out of bounds
+     */
+    int getChainId(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return NO_CHAIN;
+        }
+        return chainIds[getIndex(x, y)];
+    }
+
+    /**
+     * @brief Get the position of a node
+     * @param nodeId Node ID
+     * @return Tuple of (x, y)
+     */
+    std::tuple<int, int> getNode(int nodeId) const
+    {
+        return nodes[nodeId];
+    }
+
+    /**
+     * @brief Get a chain by ID
+     * @param chainId Chain ID
+     * @return The chain
+     */
+    const Chain& getChain(int chainId) const
+    {
+        return chains[chainId];
+    }
+
+    /**
+     * @brief Get the chains ending at a node
+     * @param nodeId Node ID
+     * @return IDs of the chains with the node as an endpoint
+     */
+    const std::vector<int>& getIncidentChains(int nodeId) const
+    {
+        return incidentChains[nodeId];
+    }
+
+    /**
+     * @brief Get the number of node slots, including inactive ones
+     * @return Node slot count
+     */
+    int getNodeCount() const
+    {
+        return static_cast<int>(nodes.size());
+    }
+
+    /**
+     * @brief Get the number of chain slots, including inactive ones
+     * @return Chain slot count
+     */
+    int getChainCount() const
+    {
+        return static_cast<int>(chains.size());
+    }
+
+    /**
+     * @brief Check if a node slot holds a node
+     * @param nodeId Node ID
+     * @return True if active
+     */
+    bool isNodeActive(int nodeId) const
+    {
+        return activeNodes[nodeId];
+    }
+
+    /**
+     * @brief Check if a chain slot holds a chain
+     * @param chainId Chain ID
+     * @return True if active
+     */
+    bool isChainActive(int chainId) const
+    {
+        return activeChains[chainId];
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the distance type the graph was built for
+     * @return The distance type
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+
+private:
+    /**
+     * @brief Convert coordinates to a tile index
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return Row-major tile index
+     */
+    std::size_t getIndex(int x, int y) const
+    {
+        return static_cast<std::size_t>(y) * width + x;
+    }
+};
@@ -12,7 +12,8 @@ enum class DistanceType
 {
     Manhattan,    // Sum of absolute differences (|dx| + |dy|)
     Chebyshev,    // Maximum of absolute differences (max(|dx|, |dy|))  
-    Euclidean     // Square root of sum of squares (sqrt(dx² + dy²))
+    Euclidean,    // Square root of sum of squares (sqrt(dx² + dy²))
+    Octile        // 8-directional with fixed-point costs (1000 orthogonal, 1414 diagonal)
 };
 
 /**
@@ -20,19 +21,24 @@ enum class DistanceType
  * 
  * A Dijkstra map stores distance values from goal tiles to all other reachable tiles.
  * Unreachable tiles retain their initial infinite distance value.
- * Supports multiple distance calculation methods.
+ * Supports multiple distance calculation methods. Distances are stored row by
+ * row, so a whole row can be accessed as one contiguous array.
  */
 class DijkstraMap
 {
 public:
     // Use a large value to represent infinite/unreachable distance
     static constexpr int UNREACHABLE = std::numeric_limits<int>::max();
+
+    // Fixed-point step costs of DistanceType::Octile (sqrt(2) scaled by 1000)
+    static constexpr int OCTILE_ORTHOGONAL_COST = 1000;
+    static constexpr int OCTILE_DIAGONAL_COST = 1414;
     
 private:
     int width;
     int height;
     DistanceType distanceType;
-    std::vector<std::vector<int>> distances;
+    std::vector<int> distances;
     
 public:
     /**
@@ -45,10 +51,27 @@ public:
         : width(mapWidth)
         , height(mapHeight)
         , distanceType(distType)
-        , distances(mapWidth, std::vector<int>(mapHeight, UNREACHABLE))
+        , distances(static_cast<std::size_t>(mapWidth) * mapHeight, UNREACHABLE)
     {
     }
     
+    /**
+     * @brief Get the movement directions, straight moves first
+     *
+     * Distance types that move diagonally use all eight; the others use the
+     * first four. Direction indices throughout the library index this list.
+     *
+     * @return Offsets (dx, dy) of the eight movement directions
+     */
+    static const std::vector<std::tuple<int, int>>& getMovementDirections()
+    {
+        static const std::vector<std::tuple<int, int>> directions = {
+            {0, 1}, {0, -1}, {1, 0}, {-1, 0},
+            {1, 1}, {1, -1}, {-1, 1}, {-1, -1}
+        };
+        return directions;
+    }
+
     /**
      * @brief Get the distance value at a specific coordinate
      * @param x X coordinate
@@ -61,7 +84,7 @@ public:
         {
             return UNREACHABLE;
         }
-        return distances[x][y];
+        return distances[static_cast<std::size_t>(y) * width + x];
     }
     
     /**
@@ -74,7 +97,7 @@ public:
     {
         if (x >= 0 && x < width && y >= 0 && y < height) 
         {
-            distances[x][y] = distance;
+            distances[static_cast<std::size_t>(y) * width + x] = distance;
         }
     }
     
@@ -100,6 +123,26 @@ public:
         return getDistance(x, y) != UNREACHABLE;
     }
     
+    /**
+     * @brief Get the distances of a row
+     * @param y Row index, must be within bounds
+     * @return Pointer to the width distance values of the row
+     */
+    int* getRow(int y)
+    {
+        return distances.data() + static_cast<std::size_t>(y) * width;
+    }
+
+    /**
+     * @brief Get the distances of a row
+     * @param y Row index, must be within bounds
+     * @return Pointer to the width distance values of the row
+     */
+    const int* getRow(int y) const
+    {
+        return distances.data() + static_cast<std::size_t>(y) * width;
+    }
+    
     /**
      * @brief Get map dimensions
      * @return Tuple of (width, height)
@@ -150,6 +193,9 @@ public:
                 
             case DistanceType::Euclidean:
                 return calculateEuclideanDistance(dx, dy);
+
+            case DistanceType::Octile:
+                return calculateOctileDistance(dx, dy);
                 
             default:
                 return calculateEuclideanDistance(dx, dy);
@@ -161,9 +207,7 @@ public:
      */
     void clear()
     {
-        for (auto& column : distances) {
-            std::fill(column.begin(), column.end(), UNREACHABLE);
-        }
+        std::fill(distances.begin(), distances.end(), UNREACHABLE);
     }
 
 private:
@@ -200,4 +244,17 @@ private:
         double distance = std::sqrt(dx * dx + dy * dy);
         return static_cast<int>(std::round(distance));
     }
+
+    /**
+     * @brief Calculate octile distance: diagonal steps first, then straight steps
+     * @param dx X difference
+     * @param dy Y difference
+     * @return Octile distance in fixed-point units (1000 per orthogonal step)
+     */
+    int calculateOctileDistance(int dx, int dy) const
+    {
+        const int diagonalSteps = std::min(std::abs(dx), std::abs(dy));
+        const int straightSteps = std::max(std::abs(dx), std::abs(dy)) - diagonalSteps;
+        return diagonalSteps * OCTILE_DIAGONAL_COST + straightSteps * OCTILE_ORTHOGONAL_COST;
+    }
 };
\ No newline at end of file
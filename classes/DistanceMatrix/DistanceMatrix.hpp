@@ -0,0 +1,101 @@
+#pragma once
+#include <tuple>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Dense matrix of distances from a list of sources to a list of targets
+ *
+ * Distances are stored row by row, one row per source, with one entry per
+ * target in the order the targets were given. Unreachable pairs hold
+ * DijkstraMap::UNREACHABLE.
+ */
+class DistanceMatrix
+{
+private:
+    int sourceCount;
+    int targetCount;
+    std::vector<int> distances;
+
+public:
+    /**
+     * @brief Constructor - initializes all distances as unreachable
+     * @param sources Number of sources (rows)
+     * @param targets Number of targets (columns)
+     */
+    DistanceMatrix(int sources, int targets)
+        : sourceCount(sources)
+        , targetCount(targets)
+        , distances(static_cast<std::size_t>(sources) * targets, DijkstraMap::UNREACHABLE)
+    {
+    }
+
+    /**
+     * @brief Get the distance from a source to a target
+     * @param source Source index
+     * @param target Target index
+     * @return Distance value, or UNREACHABLE if unreachable or out of range
+     */
+    int getDistance(int source, int target) const
+    {
+        if (!isWithinRange(source, target))
+        {
+            return DijkstraMap::UNREACHABLE;
+        }
+        return distances[static_cast<std::size_t>(source) * targetCount + target];
+    }
+
+    /**
+     * @brief Set the distance from a source to a target
+     * @param source Source index
+     * @param target Target index
+     * @param distance Distance value to set
+     */
+    void setDistance(int source, int target, int distance)
+    {
+        if (isWithinRange(source, target))
+        {
+            distances[static_cast<std::size_t>(source) * targetCount + target] = distance;
+        }
+    }
+
+    /**
+     * @brief Get the distances from one source to every target
+     * @param source Source index, must be in range
+     * @return Pointer to getTargetCount() contiguous distances
+     */
+    int* getRow(int source)
+    {
+        return distances.data() + static_cast<std::size_t>(source) * targetCount;
+    }
+
+    /**
+     * @brief Get the distances from one source to every target
+     * @param source Source index, must be in range
+     * @return Pointer to getTargetCount() contiguous distances
+     */
+    const int* getRow(int source) const
+    {
+        return distances.data() + static_cast<std::size_t>(source) * targetCount;
+    }
+
+    /**
+     * @brief Check if indices are within the matrix
+     * @param source Source index
+     * @param target Target index
+     * @return True if both indices are in range
+     */
+    bool isWithinRange(int source, int target) const
+    {
+        return source >= 0 && source < sourceCount && target >= 0 && target < targetCount;
+    }
+
+    /**
+     * @brief Get matrix dimensions
+     * @return Tuple of (source count, target count)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(sourceCount, targetCount);
+    }
+};
@@ -0,0 +1,157 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Direction to move from every tile to descend a Dijkstra map
+ *
+ * One byte per tile, stored row by row. Directions index the movement
+ * directions of the distance type: the four straight moves (0, 1), (0, -1),
+ * (1, 0), (-1, 0), then the diagonals (1, 1), (1, -1), (-1, 1), (-1, -1).
+ * Goals, unreachable tiles and local minima hold NO_DIRECTION.
+ */
+class FlowField
+{
+public:
+    // Direction of tiles with nowhere to move
+    static constexpr int NO_DIRECTION = -1;
+    // Stored form of NO_DIRECTION
+    static constexpr std::uint8_t NO_DIRECTION_BYTE = 0xFF;
+
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    std::vector<std::uint8_t> directions;
+
+public:
+    /**
+     * @brief Constructor - initializes all tiles to NO_DIRECTION
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance type selecting the movement directions (default: Euclidean)
+     */
+    FlowField(int mapWidth, int mapHeight, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , directions(static_cast<std::size_t>(mapWidth) * mapHeight, NO_DIRECTION_BYTE)
+    {
+    }
+
+    /**
+     * @brief Get the direction of a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Direction index, or NO_DIRECTION if there is none or out of bounds
+     */
+    int getDirection(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return NO_DIRECTION;
+        }
+        const std::uint8_t direction = directions[static_cast<std::size_t>(y) * width + x];
+        return (direction == NO_DIRECTION_BYTE) ? NO_DIRECTION : direction;
+    }
+
+    /**
+     * @brief Set the direction of a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param direction Direction index, or NO_DIRECTION
+     */
+    void setDirection(int x, int y, int direction)
+    {
+        if (isWithinBounds(x, y))
+        {
+            directions[static_cast<std::size_t>(y) * width + x] =
+                (direction == NO_DIRECTION) ? NO_DIRECTION_BYTE : static_cast<std::uint8_t>(direction);
+        }
+    }
+
+    /**
+     * @brief Get the step to take from a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Tuple of (dx, dy), or (0, 0) if the tile has no direction
+     */
+    std::tuple<int, int> getStep(int x, int y) const
+    {
+        const int direction = getDirection(x, y);
+        if (direction == NO_DIRECTION)
+        {
+            return std::make_tuple(0, 0);
+        }
+        return DijkstraMap::getMovementDirections()[direction];
+    }
+
+    /**
+     * @brief Get one row of stored directions
+     * @param y Row index, must be within bounds
+     * @return Pointer to width contiguous bytes, NO_DIRECTION_BYTE for no direction
+     */
+    std::uint8_t* getRow(int y)
+    {
+        return directions.data() + static_cast<std::size_t>(y) * width;
+    }
+
+    /**
+     * @brief Get one row of stored directions
+     * @param y Row index, must be within bounds
+     * @return Pointer to width contiguous bytes, NO_DIRECTION_BYTE for no direction
+     */
+    const std::uint8_t* getRow(int y) const
+    {
+        return directions.data() + static_cast<std::size_t>(y) * width;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the distance type selecting the movement directions
+     * @return The distance type being used
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+
+    /**
+     * @brief Set the distance type selecting the movement directions
+     * @param distType New distance type
+     */
+    void setDistanceType(DistanceType distType)
+    {
+        distanceType = distType;
+    }
+
+    /**
+     * @brief Clear the field - set every tile to NO_DIRECTION
+     */
+    void clear()
+    {
+        std::fill(directions.begin(), directions.end(), NO_DIRECTION_BYTE);
+    }
+};
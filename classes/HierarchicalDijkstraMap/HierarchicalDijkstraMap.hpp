@@ -0,0 +1,170 @@
+#pragma once
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Dijkstra map over a chunked grid with per-chunk lazy refinement
+ *
+ * Holds the distance of every chunk entrance from the goals. Tile distances of
+ * a chunk are only stored once that chunk has been refined; unrefined chunks
+ * report UNREACHABLE.
+ */
+class HierarchicalDijkstraMap
+{
+public:
+    // Use the same infinite distance as DijkstraMap
+    static constexpr int UNREACHABLE = DijkstraMap::UNREACHABLE;
+
+private:
+    int width;
+    int height;
+    int chunkSize;
+    int chunksX;
+    std::vector<std::tuple<int, int>> goals;
+    std::vector<std::vector<int>> entranceDistances;
+    std::vector<std::vector<int>> chunkDistances;
+
+public:
+    /**
+     * @brief Constructor - creates a map with no refined chunks
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param chunkTiles Width and height of a chunk in tiles, clamped to at least 1
+     */
+    HierarchicalDijkstraMap(int mapWidth, int mapHeight, int chunkTiles)
+        : width(mapWidth)
+        , height(mapHeight)
+        , chunkSize(std::max(1, chunkTiles))
+        , chunksX((mapWidth + chunkSize - 1) / chunkSize)
+        , entranceDistances(static_cast<std::size_t>(chunksX) * ((mapHeight + chunkSize - 1) / chunkSize))
+        , chunkDistances(entranceDistances.size())
+    {
+    }
+
+    /**
+     * @brief Get the distance value at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Distance value, or UNREACHABLE if out of bounds or the chunk is not refined
+     */
+    int getDistance(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return UNREACHABLE;
+        }
+
+        const std::vector<int>& tiles = chunkDistances[getChunkIndex(x / chunkSize, y / chunkSize)];
+        if (tiles.empty())
+        {
+            return UNREACHABLE;
+        }
+        return tiles[static_cast<std::size_t>(y % chunkSize) * chunkSize + x % chunkSize];
+    }
+
+    /**
+     * @brief Check if a chunk has tile distances
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return True if refined
+     */
+    bool isChunkRefined(int chunkX, int chunkY) const
+    {
+        return !chunkDistances[getChunkIndex(chunkX, chunkY)].empty();
+    }
+
+    /**
+     * @brief Store the tile distances of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param distances chunkSize x chunkSize row-major distances, UNREACHABLE past the map edge
+     */
+    void setChunkDistances(int chunkX, int chunkY, std::vector<int> distances)
+    {
+        chunkDistances[getChunkIndex(chunkX, chunkY)] = std::move(distances);
+    }
+
+    /**
+     * @brief Get the distances of a chunk's entrances
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return One distance per entrance, in ChunkHierarchy entrance order
+     */
+    const std::vector<int>& getEntranceDistances(int chunkX, int chunkY) const
+    {
+        return entranceDistances[getChunkIndex(chunkX, chunkY)];
+    }
+
+    /**
+     * @brief Set the distances of a chunk's entrances
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @param distances One distance per entrance, in ChunkHierarchy entrance order
+     */
+    void setEntranceDistances(int chunkX, int chunkY, std::vector<int> distances)
+    {
+        entranceDistances[getChunkIndex(chunkX, chunkY)] = std::move(distances);
+    }
+
+    /**
+     * @brief Get the goal positions the map was generated for
+     * @return Goal positions
+     */
+    const std::vector<std::tuple<int, int>>& getGoals() const
+    {
+        return goals;
+    }
+
+    /**
+     * @brief Set the goal positions the map was generated for
+     * @param goalPositions Goal positions
+     */
+    void setGoals(std::vector<std::tuple<int, int>> goalPositions)
+    {
+        goals = std::move(goalPositions);
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the width and height of a chunk
+     * @return Chunk size in tiles
+     */
+    int getChunkSize() const
+    {
+        return chunkSize;
+    }
+
+private:
+    /**
+     * @brief Get the index of a chunk
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Row-major chunk index
+     */
+    int getChunkIndex(int chunkX, int chunkY) const
+    {
+        return chunkY * chunksX + chunkX;
+    }
+};
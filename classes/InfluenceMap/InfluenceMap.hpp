@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <tuple>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Summed influence of sources (threat, scent, faction control) on every tile
+ *
+ * Laid out like DijkstraMap, row by row, but each tile holds a fixed-point
+ * influence: FIXED_POINT_SCALE raw units per 1.0. Integer sums do not depend
+ * on the order sources are added in, so influence generated on any number of
+ * threads is identical. Tiles no source reaches hold 0.
+ */
+class InfluenceMap
+{
+public:
+    // Raw units per 1.0 of influence
+    static constexpr int FIXED_POINT_SCALE = 1024;
+
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    std::vector<int> values;
+
+public:
+    /**
+     * @brief Constructor - initializes all influence to 0
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance type of the propagation (default: Euclidean)
+     */
+    InfluenceMap(int mapWidth, int mapHeight, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , values(static_cast<std::size_t>(mapWidth) * mapHeight, 0)
+    {
+    }
+
+    /**
+     * @brief Get the influence at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Influence, or 0 if out of bounds
+     */
+    float getInfluence(int x, int y) const
+    {
+        return static_cast<float>(getRawInfluence(x, y)) / FIXED_POINT_SCALE;
+    }
+
+    /**
+     * @brief Get the fixed-point influence at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Influence in raw units, or 0 if out of bounds
+     */
+    int getRawInfluence(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return 0;
+        }
+        return values[static_cast<std::size_t>(y) * width + x];
+    }
+
+    /**
+     * @brief Set the fixed-point influence at a specific coordinate
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param rawInfluence Influence in raw units
+     */
+    void setRawInfluence(int x, int y, int rawInfluence)
+    {
+        if (isWithinBounds(x, y))
+        {
+            values[static_cast<std::size_t>(y) * width + x] = rawInfluence;
+        }
+    }
+
+    /**
+     * @brief Get one row of fixed-point influence
+     * @param y Row index, must be within bounds
+     * @return Pointer to width contiguous raw values
+     */
+    int* getRow(int y)
+    {
+        return values.data() + static_cast<std::size_t>(y) * width;
+    }
+
+    /**
+     * @brief Get one row of fixed-point influence
+     * @param y Row index, must be within bounds
+     * @return Pointer to width contiguous raw values
+     */
+    const int* getRow(int y) const
+    {
+        return values.data() + static_cast<std::size_t>(y) * width;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the current distance calculation type
+     * @return The distance type being used
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+
+    /**
+     * @brief Set the distance calculation type
+     * @param distType New distance calculation method
+     */
+    void setDistanceType(DistanceType distType)
+    {
+        distanceType = distType;
+    }
+
+    /**
+     * @brief Clear the map - set all influence to 0
+     */
+    void clear()
+    {
+        std::fill(values.begin(), values.end(), 0);
+    }
+};
@@ -0,0 +1,107 @@
+#pragma once
+#include <tuple>
+#include "classes/BitGrid/BitGrid.hpp"
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Bit-packed walkability for jump point search
+ *
+ * Walkable tiles are stored twice: row by row, and transposed column by
+ * column, so both horizontal and vertical jumps scan 64 tiles per word.
+ * Changing a tile costs two bit writes; there are no tables to rebuild.
+ */
+class JumpPointGrid
+{
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    BitGrid rows;
+    BitGrid columns;
+
+public:
+    /**
+     * @brief Constructor - initializes all tiles as not walkable
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance type of the searches
+     */
+    JumpPointGrid(int mapWidth, int mapHeight, DistanceType distType)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , rows(mapWidth, mapHeight)
+        , columns(mapHeight, mapWidth)
+    {
+    }
+
+    /**
+     * @brief Check if a tile is walkable
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if walkable, false if not or out of bounds
+     */
+    bool isWalkable(int x, int y) const
+    {
+        return rows.get(x, y);
+    }
+
+    /**
+     * @brief Set whether a tile is walkable
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param walkable New walkability
+     */
+    void setWalkable(int x, int y, bool walkable)
+    {
+        rows.set(x, y, walkable);
+        columns.set(y, x, walkable);
+    }
+
+    /**
+     * @brief Get the walkable tiles row by row
+     * @return Grid with bit x of row y set for walkable tile (x, y)
+     */
+    const BitGrid& getRows() const
+    {
+        return rows;
+    }
+
+    /**
+     * @brief Get the walkable tiles column by column
+     * @return Grid with bit y of row x set for walkable tile (x, y)
+     */
+    const BitGrid& getColumns() const
+    {
+        return columns;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the distance type of the searches
+     * @return Distance type
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+};
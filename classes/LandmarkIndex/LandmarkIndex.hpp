@@ -0,0 +1,199 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Distances from a few landmark tiles to every tile, for A* lower bounds
+ *
+ * By the triangle inequality, |d(L, a) - d(L, b)| never exceeds d(a, b) for
+ * any landmark L. Distances are stored as 16-bit values, tile-major so the
+ * landmarks of one tile are adjacent. Each landmark has a scale factor: a
+ * stored value q means a distance in [q * scale, q * scale + scale - 1].
+ */
+class LandmarkIndex
+{
+public:
+    // Stored value of tiles a landmark cannot reach
+    static constexpr std::uint16_t NO_DISTANCE = 0xFFFF;
+
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    std::vector<std::tuple<int, int>> landmarks;
+    std::vector<int> scales;
+    std::vector<std::uint16_t> distances;
+
+public:
+    /**
+     * @brief Constructor - creates an index without landmarks
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance type of the landmark maps
+     */
+    LandmarkIndex(int mapWidth, int mapHeight, DistanceType distType)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+    {
+    }
+
+    /**
+     * @brief Add a landmark and its distances
+     * @param x Landmark X coordinate
+     * @param y Landmark Y coordinate
+     * @param landmarkMap Dijkstra map with the landmark as its only goal, same size as the index
+     */
+    void addLandmark(int x, int y, const DijkstraMap& landmarkMap)
+    {
+        const std::size_t tileCount = static_cast<std::size_t>(width) * height;
+        const std::size_t oldCount = landmarks.size();
+        const std::size_t newCount = oldCount + 1;
+
+        int maxDistance = 0;
+        for (int tileY = 0; tileY < height; ++tileY)
+        {
+            const int* row = landmarkMap.getRow(tileY);
+            for (int tileX = 0; tileX < width; ++tileX)
+            {
+                if (row[tileX] != DijkstraMap::UNREACHABLE)
+                {
+                    maxDistance = std::max(maxDistance, row[tileX]);
+                }
+            }
+        }
+        // Smallest scale that keeps every finite distance below NO_DISTANCE
+        const int scale = maxDistance / (NO_DISTANCE - 1) + 1;
+
+        std::vector<std::uint16_t> widened(tileCount * newCount);
+        for (int tileY = 0; tileY < height; ++tileY)
+        {
+            const int* row = landmarkMap.getRow(tileY);
+            for (int tileX = 0; tileX < width; ++tileX)
+            {
+                const std::size_t tile = static_cast<std::size_t>(tileY) * width + tileX;
+                std::copy_n(distances.begin() + tile * oldCount, oldCount, widened.begin() + tile * newCount);
+                widened[tile * newCount + oldCount] = (row[tileX] == DijkstraMap::UNREACHABLE)
+                    ? NO_DISTANCE
+                    : static_cast<std::uint16_t>(row[tileX] / scale);
+            }
+        }
+
+        distances = std::move(widened);
+        landmarks.emplace_back(x, y);
+        scales.push_back(scale);
+    }
+
+    /**
+     * @brief Get a lower bound on the distance between two tiles
+     * @param x1 First tile X coordinate
+     * @param y1 First tile Y coordinate
+     * @param x2 Second tile X coordinate
+     * @param y2 Second tile Y coordinate
+     * @return Largest bound over all landmarks, 0 if none applies or out of bounds
+     */
+    int getLowerBound(int x1, int y1, int x2, int y2) const
+    {
+        if (!isWithinBounds(x1, y1) || !isWithinBounds(x2, y2))
+        {
+            return 0;
+        }
+
+        const std::size_t count = landmarks.size();
+        const std::uint16_t* first = distances.data() + (static_cast<std::size_t>(y1) * width + x1) * count;
+        const std::uint16_t* second = distances.data() + (static_cast<std::size_t>(y2) * width + x2) * count;
+
+        int bound = 0;
+        for (std::size_t landmark = 0; landmark < count; ++landmark)
+        {
+            if (first[landmark] == NO_DISTANCE || second[landmark] == NO_DISTANCE)
+            {
+                continue;
+            }
+            // Rounding can hide up to scale - 1 of the difference
+            const int difference = std::abs(static_cast<int>(first[landmark]) - static_cast<int>(second[landmark]));
+            bound = std::max(bound, difference * scales[landmark] - (scales[landmark] - 1));
+        }
+        return bound;
+    }
+
+    /**
+     * @brief Get the stored distance from a landmark to a tile
+     * @param landmark Landmark index
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Distance rounded down to a multiple of the landmark's scale, or UNREACHABLE
+     */
+    int getDistance(int landmark, int x, int y) const
+    {
+        if (!isWithinBounds(x, y) || landmark < 0 || landmark >= getLandmarkCount())
+        {
+            return DijkstraMap::UNREACHABLE;
+        }
+        const std::uint16_t stored = distances[(static_cast<std::size_t>(y) * width + x) * landmarks.size() + landmark];
+        return (stored == NO_DISTANCE) ? DijkstraMap::UNREACHABLE : stored * scales[landmark];
+    }
+
+    /**
+     * @brief Get the position of a landmark
+     * @param landmark Landmark index, must be valid
+     * @return Tuple of (x, y)
+     */
+    std::tuple<int, int> getLandmark(int landmark) const
+    {
+        return landmarks[landmark];
+    }
+
+    /**
+     * @brief Get the scale factor of a landmark's stored distances
+     * @param landmark Landmark index, must be valid
+     * @return Scale factor, 1 if distances are stored exactly
+     */
+    int getScale(int landmark) const
+    {
+        return scales[landmark];
+    }
+
+    /**
+     * @brief Get the number of landmarks
+     * @return Landmark count
+     */
+    int getLandmarkCount() const
+    {
+        return static_cast<int>(landmarks.size());
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the distance type of the landmark maps
+     * @return Distance type
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+};
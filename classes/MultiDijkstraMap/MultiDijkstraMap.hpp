@@ -0,0 +1,174 @@
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Several Dijkstra maps over the same grid, stored channel-interleaved
+ *
+ * Each tile holds Channels consecutive distance values, one per channel, so a
+ * single traversal can update every channel of a tile with one memory access.
+ * Unreachable tiles in a channel keep the UNREACHABLE value.
+ *
+ * @tparam Channels Number of distance channels per tile
+ */
+template<int Channels>
+class MultiDijkstraMap
+{
+    static_assert(Channels > 0, "MultiDijkstraMap needs at least one channel");
+
+public:
+    // Use the same infinite distance as DijkstraMap
+    static constexpr int UNREACHABLE = DijkstraMap::UNREACHABLE;
+    static constexpr int CHANNELS = Channels;
+
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    std::vector<int> distances;
+
+public:
+    /**
+     * @brief Constructor - initializes all distances of all channels to UNREACHABLE
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance calculation method (default: Euclidean)
+     */
+    MultiDijkstraMap(int mapWidth, int mapHeight, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , distances(static_cast<std::size_t>(mapWidth) * mapHeight * Channels, UNREACHABLE)
+    {
+    }
+
+    /**
+     * @brief Get the distance value of one channel at a specific coordinate
+     * @param channel Channel index in [0, Channels)
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Distance value, or UNREACHABLE if out of bounds
+     */
+    int getDistance(int channel, int x, int y) const
+    {
+        if (!isWithinBounds(x, y) || channel < 0 || channel >= Channels)
+        {
+            return UNREACHABLE;
+        }
+        return getTile(x, y)[channel];
+    }
+
+    /**
+     * @brief Set the distance value of one channel at a specific coordinate
+     * @param channel Channel index in [0, Channels)
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param distance Distance value to set
+     */
+    void setDistance(int channel, int x, int y, int distance)
+    {
+        if (isWithinBounds(x, y) && channel >= 0 && channel < Channels)
+        {
+            getTile(x, y)[channel] = distance;
+        }
+    }
+
+    /**
+     * @brief Check if a tile is reachable in one channel
+     * @param channel Channel index in [0, Channels)
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if reachable
+     */
+    bool isReachable(int channel, int x, int y) const
+    {
+        return getDistance(channel, x, y) != UNREACHABLE;
+    }
+
+    /**
+     * @brief Get the channel values of a tile
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return Pointer to Channels consecutive distance values
+     */
+    int* getTile(int x, int y)
+    {
+        return distances.data() + (static_cast<std::size_t>(y) * width + x) * Channels;
+    }
+
+    /**
+     * @brief Get the channel values of a tile
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return Pointer to Channels consecutive distance values
+     */
+    const int* getTile(int x, int y) const
+    {
+        return distances.data() + (static_cast<std::size_t>(y) * width + x) * Channels;
+    }
+
+    /**
+     * @brief Copy one channel into a standalone Dijkstra map
+     * @param channel Channel index in [0, Channels)
+     * @return Dijkstra map holding the channel's distances
+     */
+    DijkstraMap extractChannel(int channel) const
+    {
+        DijkstraMap dijkstraMap(width, height, distanceType);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                dijkstraMap.setDistance(x, y, getDistance(channel, x, y));
+            }
+        }
+        return dijkstraMap;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the current distance calculation type
+     * @return The distance type being used
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+
+    /**
+     * @brief Set the distance calculation type
+     * @param distType New distance calculation method
+     */
+    void setDistanceType(DistanceType distType)
+    {
+        distanceType = distType;
+    }
+
+    /**
+     * @brief Clear the map - reset all distances of all channels to UNREACHABLE
+     */
+    void clear()
+    {
+        std::fill(distances.begin(), distances.end(), UNREACHABLE);
+    }
+};
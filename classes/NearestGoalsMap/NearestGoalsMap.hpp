@@ -0,0 +1,176 @@
+#pragma once
+#include <algorithm>
+#include <tuple>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Distances to the K nearest distinct goals of every tile
+ *
+ * Each tile holds K fixed-size slots of (distance, goal ID), sorted by
+ * distance and then goal ID, so rank 0 is the nearest goal. Goal IDs are
+ * indices into the goal list the map was generated from. Tiles that reach
+ * fewer than K goals keep UNREACHABLE / NO_GOAL in their last slots.
+ *
+ * @tparam K Number of goals kept per tile
+ */
+template<int K>
+class NearestGoalsMap
+{
+    static_assert(K > 0, "NearestGoalsMap needs at least one slot per tile");
+
+public:
+    // Use the same infinite distance as DijkstraMap
+    static constexpr int UNREACHABLE = DijkstraMap::UNREACHABLE;
+    // Goal of empty slots
+    static constexpr int NO_GOAL = -1;
+    static constexpr int SLOTS = K;
+
+    /**
+     * @brief Distance to one goal
+     */
+    struct Slot
+    {
+        int distance;
+        int goal;
+    };
+
+private:
+    int width;
+    int height;
+    DistanceType distanceType;
+    std::vector<Slot> slots;
+
+public:
+    /**
+     * @brief Constructor - initializes all slots as empty
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance calculation method (default: Euclidean)
+     */
+    NearestGoalsMap(int mapWidth, int mapHeight, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , slots(static_cast<std::size_t>(mapWidth) * mapHeight * K, Slot{UNREACHABLE, NO_GOAL})
+    {
+    }
+
+    /**
+     * @brief Get the distance to the goal of a rank
+     * @param rank Rank in [0, K), 0 for the nearest goal
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Distance value, or UNREACHABLE if the slot is empty or out of bounds
+     */
+    int getDistance(int rank, int x, int y) const
+    {
+        if (!isWithinBounds(x, y) || rank < 0 || rank >= K)
+        {
+            return UNREACHABLE;
+        }
+        return getSlots(x, y)[rank].distance;
+    }
+
+    /**
+     * @brief Get the goal of a rank
+     * @param rank Rank in [0, K), 0 for the nearest goal
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Goal ID, or NO_GOAL if the slot is empty or out of bounds
+     */
+    int getGoal(int rank, int x, int y) const
+    {
+        if (!isWithinBounds(x, y) || rank < 0 || rank >= K)
+        {
+            return NO_GOAL;
+        }
+        return getSlots(x, y)[rank].goal;
+    }
+
+    /**
+     * @brief Get the slots of a tile
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return Pointer to K consecutive slots, nearest first
+     */
+    Slot* getSlots(int x, int y)
+    {
+        return slots.data() + (static_cast<std::size_t>(y) * width + x) * K;
+    }
+
+    /**
+     * @brief Get the slots of a tile
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return Pointer to K consecutive slots, nearest first
+     */
+    const Slot* getSlots(int x, int y) const
+    {
+        return slots.data() + (static_cast<std::size_t>(y) * width + x) * K;
+    }
+
+    /**
+     * @brief Copy the distances of one rank into a standalone Dijkstra map
+     * @param rank Rank in [0, K)
+     * @return Dijkstra map holding the rank's distances
+     */
+    DijkstraMap extractRank(int rank) const
+    {
+        DijkstraMap dijkstraMap(width, height, distanceType);
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                dijkstraMap.setDistance(x, y, getDistance(rank, x, y));
+            }
+        }
+        return dijkstraMap;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the current distance calculation type
+     * @return The distance type being used
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+
+    /**
+     * @brief Set the distance calculation type
+     * @param distType New distance calculation method
+     */
+    void setDistanceType(DistanceType distType)
+    {
+        distanceType = distType;
+    }
+
+    /**
+     * @brief Clear the map - empty every slot of every tile
+     */
+    void clear()
+    {
+        std::fill(slots.begin(), slots.end(), Slot{UNREACHABLE, NO_GOAL});
+    }
+};
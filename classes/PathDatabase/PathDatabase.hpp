@@ -0,0 +1,208 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+#include "classes/BitGrid/BitGrid.hpp"
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief First-move tables for every pair of tiles on a static map
+ *
+ * There is one row per goal tile. It holds, for every tile in scan order,
+ * the index of the first step of a shortest path from that tile toward the
+ * goal. Moves index the movement directions of the distance type: the four
+ * straight moves (0, 1), (0, -1), (1, 0), (-1, 0), then the diagonals
+ * (1, 1), (1, -1), (-1, 1), (-1, -1).
+ *
+ * Rows are run-length compressed. A run is packed into 32 bits: the tile it
+ * starts at, then 4 bits of move. Non-walkable tiles and the goal itself
+ * never start a run, so they extend whichever run they fall in, which keeps
+ * rows short. Maps are limited to 2^28 tiles.
+ */
+class PathDatabase
+{
+public:
+    // Move of tiles without a path to the goal
+    static constexpr int NO_MOVE = -1;
+    // Largest tile count whose indices fit beside a move in a packed run
+    static constexpr std::int64_t MAX_TILE_COUNT = std::int64_t(1) << 28;
+
+private:
+    static constexpr int MOVE_BITS = 4;
+    static constexpr std::uint32_t MOVE_MASK = (1u << MOVE_BITS) - 1;
+    // Stored form of NO_MOVE
+    static constexpr std::uint32_t NO_MOVE_BITS = MOVE_MASK;
+
+    int width;
+    int height;
+    DistanceType distanceType;
+    BitGrid walkable;
+    std::vector<std::uint32_t> firstRuns;
+    std::vector<std::uint32_t> runs;
+
+public:
+    /**
+     * @brief Constructor - creates a database without walkable tiles or rows
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     * @param distType Distance type selecting connectivity and step costs
+     */
+    PathDatabase(int mapWidth, int mapHeight, DistanceType distType = DistanceType::Euclidean)
+        : width(mapWidth)
+        , height(mapHeight)
+        , distanceType(distType)
+        , walkable(mapWidth, mapHeight)
+        , firstRuns(1, 0)
+    {
+    }
+
+    /**
+     * @brief Check if a tile is walkable
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if walkable, false if not or out of bounds
+     */
+    bool isWalkable(int x, int y) const
+    {
+        return walkable.get(x, y);
+    }
+
+    /**
+     * @brief Set whether a tile is walkable
+     *
+     * The rows are not updated; set walkability before adding them.
+     *
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param isWalkable New walkability
+     */
+    void setWalkable(int x, int y, bool isWalkable)
+    {
+        walkable.set(x, y, isWalkable);
+    }
+
+    /**
+     * @brief Start the row of the next goal tile in scan order
+     */
+    void addRow()
+    {
+        firstRuns.push_back(firstRuns.back());
+    }
+
+    /**
+     * @brief Append a run to the most recently added row
+     * @param firstTile Tile index (y * width + x) the run starts at; 0 for the first run of a row
+     * @param move Direction index, or NO_MOVE
+     */
+    void addRun(int firstTile, int move)
+    {
+        const std::uint32_t moveBits = (move == NO_MOVE) ? NO_MOVE_BITS : static_cast<std::uint32_t>(move);
+        runs.push_back((static_cast<std::uint32_t>(firstTile) << MOVE_BITS) | moveBits);
+        ++firstRuns.back();
+    }
+
+    /**
+     * @brief Look up the first move of a shortest path
+     *
+     * Binary search over the runs of the goal's row; no search of the map.
+     *
+     * @param fromX X coordinate of the tile to move from
+     * @param fromY Y coordinate of the tile to move from
+     * @param goalX X coordinate of the goal
+     * @param goalY Y coordinate of the goal
+     * @return Direction index, or NO_MOVE if the tiles are equal, blocked, unconnected or out of bounds
+     */
+    int getFirstMove(int fromX, int fromY, int goalX, int goalY) const
+    {
+        if (!isWalkable(fromX, fromY) || !isWalkable(goalX, goalY) || (fromX == goalX && fromY == goalY))
+        {
+            return NO_MOVE;
+        }
+
+        const std::size_t goalTile = static_cast<std::size_t>(goalY) * width + goalX;
+        if (goalTile + 1 >= firstRuns.size())
+        {
+            return NO_MOVE;
+        }
+
+        // Last run starting at or before the tile
+        const std::uint32_t key = (static_cast<std::uint32_t>(fromY * width + fromX) << MOVE_BITS) | MOVE_MASK;
+        const auto rowBegin = runs.begin() + firstRuns[goalTile];
+        const auto run = std::upper_bound(rowBegin, runs.begin() + firstRuns[goalTile + 1], key);
+        if (run == rowBegin)
+        {
+            return NO_MOVE;
+        }
+
+        const std::uint32_t moveBits = *(run - 1) & MOVE_MASK;
+        return (moveBits == NO_MOVE_BITS) ? NO_MOVE : static_cast<int>(moveBits);
+    }
+
+    /**
+     * @brief Get the number of rows added so far
+     * @return Row count
+     */
+    int getRowCount() const
+    {
+        return static_cast<int>(firstRuns.size()) - 1;
+    }
+
+    /**
+     * @brief Get the number of runs in a goal's row
+     * @param goalX X coordinate of the goal
+     * @param goalY Y coordinate of the goal
+     * @return Run count, or 0 if out of bounds or the row was not added
+     */
+    int getRowRunCount(int goalX, int goalY) const
+    {
+        if (!isWithinBounds(goalX, goalY))
+        {
+            return 0;
+        }
+        const std::size_t goalTile = static_cast<std::size_t>(goalY) * width + goalX;
+        if (goalTile + 1 >= firstRuns.size())
+        {
+            return 0;
+        }
+        return static_cast<int>(firstRuns[goalTile + 1] - firstRuns[goalTile]);
+    }
+
+    /**
+     * @brief Get the total number of runs
+     * @return Run count over all rows
+     */
+    int getRunCount() const
+    {
+        return static_cast<int>(runs.size());
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Get the distance type of the tables
+     * @return Distance type
+     */
+    DistanceType getDistanceType() const
+    {
+        return distanceType;
+    }
+};
@@ -0,0 +1,119 @@
+#pragma once
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Partition of the walkable tiles of a grid into wall-free rectangles
+ *
+ * Every walkable tile belongs to exactly one rectangle and stores its ID.
+ * Non-walkable tiles are NO_RECTANGLE. Rectangle IDs are dense, in the range
+ * [0, getRectangleCount()).
+ */
+class RectangleDecomposition
+{
+public:
+    // ID of non-walkable and out-of-bounds tiles
+    static constexpr int NO_RECTANGLE = -1;
+
+    /**
+     * @brief Tiles [x, x + width) x [y, y + height)
+     */
+    struct Rectangle
+    {
+        int x;
+        int y;
+        int width;
+        int height;
+    };
+
+private:
+    int width;
+    int height;
+    std::vector<int> rectangleIds;
+    std::vector<Rectangle> rectangles;
+
+public:
+    /**
+     * @brief Constructor - creates a decomposition without rectangles
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     */
+    RectangleDecomposition(int mapWidth, int mapHeight)
+        : width(mapWidth)
+        , height(mapHeight)
+        , rectangleIds(static_cast<std::size_t>(mapWidth) * mapHeight, NO_RECTANGLE)
+    {
+    }
+
+    /**
+     * @brief Add a rectangle and assign its tiles to it
+     * @param rectangle Rectangle to add, within bounds and not overlapping other rectangles
+     * @return ID of the new rectangle
+     */
+    int addRectangle(const Rectangle& rectangle)
+    {
+        const int rectangleId = getRectangleCount();
+        rectangles.push_back(rectangle);
+
+        for (int y = rectangle.y; y < rectangle.y + rectangle.height; ++y) {
+            for (int x = rectangle.x; x < rectangle.x + rectangle.width; ++x) {
+                rectangleIds[static_cast<std::size_t>(y) * width + x] = rectangleId;
+            }
+        }
+        return rectangleId;
+    }
+
+    /**
+     * @brief Get the ID of the rectangle containing a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Rectangle ID, or NO_RECTANGLE if not walkable or out of bounds
+     */
+    int getRectangleId(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return NO_RECTANGLE;
+        }
+        return rectangleIds[static_cast<std::size_t>(y) * width + x];
+    }
+
+    /**
+     * @brief Get a rectangle by ID
+     * @param rectangleId Rectangle ID in [0, getRectangleCount())
+     * @return The rectangle
+     */
+    const Rectangle& getRectangle(int rectangleId) const
+    {
+        return rectangles[rectangleId];
+    }
+
+    /**
+     * @brief Get the number of rectangles
+     * @return Rectangle count
+     */
+    int getRectangleCount() const
+    {
+        return static_cast<int>(rectangles.size());
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+};
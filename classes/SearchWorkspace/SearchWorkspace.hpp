@@ -0,0 +1,206 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <vector>
+#include "classes/DijkstraMap/DijkstraMap.hpp"
+
+/**
+ * @brief Reusable scratch storage for point-to-point searches
+ *
+ * Distances and parents are tagged with the generation of the search that
+ * wrote them, so reset() invalidates all of them in O(1) instead of clearing
+ * the whole grid. The open list keeps its capacity between searches.
+ */
+class SearchWorkspace
+{
+public:
+    // Open list entries: (priority, x, y)
+    using HeapEntry = std::tuple<int, int, int>;
+
+    // Use the same infinite distance as DijkstraMap
+    static constexpr int UNREACHABLE = DijkstraMap::UNREACHABLE;
+    static constexpr int NO_PARENT = -1;
+
+private:
+    int width;
+    int height;
+    std::uint32_t generation;
+    std::vector<std::uint32_t> generations;
+    std::vector<int> distances;
+    std::vector<int> parents;
+    std::vector<HeapEntry> heap;
+    int expansionCount;
+
+public:
+    /**
+     * @brief Constructor - creates an empty workspace for a map size
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     */
+    SearchWorkspace(int mapWidth, int mapHeight)
+        : width(mapWidth)
+        , height(mapHeight)
+        , generation(1)
+        , generations(static_cast<std::size_t>(mapWidth) * mapHeight, 0)
+        , distances(static_cast<std::size_t>(mapWidth) * mapHeight, UNREACHABLE)
+        , parents(static_cast<std::size_t>(mapWidth) * mapHeight, NO_PARENT)
+        , expansionCount(0)
+    {
+    }
+
+    /**
+     * @brief Start a new search - forget all distances, parents and open entries
+     */
+    void reset()
+    {
+        ++generation;
+        if (generation == 0)
+        {
+            // Wrapped around: old tags could look current again
+            std::fill(generations.begin(), generations.end(), 0);
+            generation = 1;
+        }
+        heap.clear();
+        expansionCount = 0;
+    }
+
+    /**
+     * @brief Get the distance found so far for a tile
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Distance, or UNREACHABLE if not reached in this search or out of bounds
+     */
+    int getDistance(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return UNREACHABLE;
+        }
+        const std::size_t index = getIndex(x, y);
+        return (generations[index] == generation) ? distances[index] : UNREACHABLE;
+    }
+
+    /**
+     * @brief Record the distance of a tile and the tile it was reached from
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @param distance Distance of the tile
+     * @param parentIndex Row-major index of the previous tile, or NO_PARENT
+     */
+    void setDistance(int x, int y, int distance, int parentIndex)
+    {
+        const std::size_t index = getIndex(x, y);
+        generations[index] = generation;
+        distances[index] = distance;
+        parents[index] = parentIndex;
+    }
+
+    /**
+     * @brief Get the tile a tile was reached from
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Row-major index of the previous tile, or NO_PARENT
+     */
+    int getParentIndex(int x, int y) const
+    {
+        if (!isWithinBounds(x, y))
+        {
+            return NO_PARENT;
+        }
+        const std::size_t index = getIndex(x, y);
+        return (generations[index] == generation) ? parents[index] : NO_PARENT;
+    }
+
+    /**
+     * @brief Add an open list entry
+     * @param priority Key of the entry, smallest first
+     * @param x X coordinate
+     * @param y Y coordinate
+     */
+    void push(int priority, int x, int y)
+    {
+        heap.emplace_back(priority, x, y);
+        std::push_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+    }
+
+    /**
+     * @brief Remove the open list entry with the smallest priority
+     * @return Tuple of (priority, x, y); the open list must not be empty
+     */
+    HeapEntry pop()
+    {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+        const HeapEntry entry = heap.back();
+        heap.pop_back();
+        return entry;
+    }
+
+    /**
+     * @brief Peek at the open list entry with the smallest priority
+     * @return Tuple of (priority, x, y); the open list must not be empty
+     */
+    const HeapEntry& top() const
+    {
+        return heap.front();
+    }
+
+    /**
+     * @brief Check if the open list is empty
+     * @return True if empty
+     */
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    /**
+     * @brief Count one expanded tile
+     */
+    void countExpansion()
+    {
+        ++expansionCount;
+    }
+
+    /**
+     * @brief Get the number of tiles expanded since the last reset
+     * @return Expansion count
+     */
+    int getExpansionCount() const
+    {
+        return expansionCount;
+    }
+
+    /**
+     * @brief Check if coordinates are within map bounds
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return True if within bounds
+     */
+    bool isWithinBounds(int x, int y) const
+    {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+private:
+    /**
+     * @brief Convert coordinates to a tile index
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @return Row-major tile index
+     */
+    std::size_t getIndex(int x, int y) const
+    {
+        return static_cast<std::size_t>(y) * width + x;
+    }
+};
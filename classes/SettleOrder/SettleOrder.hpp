@@ -0,0 +1,129 @@
+#pragma once
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Tiles of a Dijkstra map in the order the flood fill settled them
+ *
+ * Tiles are settled in nondecreasing distance, so every distance band
+ * [minDistance, maxDistance] is one contiguous range of the order. The
+ * boundaries between distance levels are recorded as tiles are added, and a
+ * band is found with two binary searches over them.
+ */
+class SettleOrder
+{
+private:
+    int width;
+    int height;
+    std::vector<int> tiles;
+    std::vector<int> levelDistances;
+    std::vector<int> levelStarts;
+
+public:
+    /**
+     * @brief Constructor - creates an empty order
+     * @param mapWidth Width of the map
+     * @param mapHeight Height of the map
+     */
+    SettleOrder(int mapWidth, int mapHeight)
+        : width(mapWidth)
+        , height(mapHeight)
+    {
+    }
+
+    /**
+     * @brief Append the next settled tile
+     * @param x X coordinate, must be within bounds
+     * @param y Y coordinate, must be within bounds
+     * @param distance Distance of the tile, no smaller than that of the previous tile
+     */
+    void addTile(int x, int y, int distance)
+    {
+        if (levelDistances.empty() || levelDistances.back() != distance)
+        {
+            levelDistances.push_back(distance);
+            levelStarts.push_back(getTileCount());
+        }
+        tiles.push_back(y * width + x);
+    }
+
+    /**
+     * @brief Find the tiles with a distance in a band
+     * @param minDistance Smallest distance of the band
+     * @param maxDistance Largest distance of the band, inclusive
+     * @return Tuple of (first, last) settle indices, last exclusive; empty if minDistance > maxDistance
+     */
+    std::tuple<int, int> findBand(int minDistance, int maxDistance) const
+    {
+        const int first = getLevelStart(std::lower_bound(levelDistances.begin(), levelDistances.end(), minDistance));
+        if (minDistance > maxDistance)
+        {
+            return std::make_tuple(first, first);
+        }
+        const int last = getLevelStart(std::upper_bound(levelDistances.begin(), levelDistances.end(), maxDistance));
+        return std::make_tuple(first, last);
+    }
+
+    /**
+     * @brief Get the position of a settled tile
+     * @param index Settle index in [0, getTileCount())
+     * @return Tuple of (x, y)
+     */
+    std::tuple<int, int> getTile(int index) const
+    {
+        return std::make_tuple(tiles[index] % width, tiles[index] / width);
+    }
+
+    /**
+     * @brief Get the number of settled tiles
+     * @return Tile count
+     */
+    int getTileCount() const
+    {
+        return static_cast<int>(tiles.size());
+    }
+
+    /**
+     * @brief Get the number of distinct distances
+     * @return Level count
+     */
+    int getLevelCount() const
+    {
+        return static_cast<int>(levelDistances.size());
+    }
+
+    /**
+     * @brief Get map dimensions
+     * @return Tuple of (width, height)
+     */
+    std::tuple<int, int> getDimensions() const
+    {
+        return std::make_tuple(width, height);
+    }
+
+    /**
+     * @brief Clear the order
+     */
+    void clear()
+    {
+        tiles.clear();
+        levelDistances.clear();
+        levelStarts.clear();
+    }
+
+private:
+    /**
+     * @brief Get the first settle index of a level
+     * @param level Iterator into levelDistances, end() for past the last level
+     * @return Settle index
+     */
+    int getLevelStart(std::vector<int>::const_iterator level) const
+    {
+        if (level == levelDistances.end())
+        {
+            return getTileCount();
+        }
+        return levelStarts[level - levelDistances.begin()];
+    }
+};
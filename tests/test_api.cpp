@@ -134,6 +134,74 @@ TEST_F(DijkstraMapAPITest, FindUnreachableTilesNoGoals) {
     EXPECT_EQ(unreachable.size(), mapWidth * mapHeight);
 }
 
+// Test streaming output for unreachable tiles
+TEST_F(DijkstraMapAPITest, ForEachUnreachableTileMatchesList) {
+    DijkstraMap map(mapWidth, mapHeight, DistanceType::Manhattan);
+    CoordList goals = {{0, 0}};
+
+    generateDijkstraMap(map, goals, walkableWithWalls);
+
+    int visited = 0;
+    forEachUnreachableTile(map, walkableWithWalls, [&](int x, int y) {
+        EXPECT_GE(x, 6);
+        EXPECT_TRUE(walkableWithWalls(x, y));
+        ++visited;
+    });
+
+    EXPECT_EQ(visited, static_cast<int>(findUnreachableTiles(map, walkableWithWalls).size()));
+}
+
+TEST_F(DijkstraMapAPITest, FindUnreachableSpansPerRow) {
+    DijkstraMap map(mapWidth, mapHeight, DistanceType::Manhattan);
+    CoordList goals = {{0, 0}};
+
+    generateDijkstraMap(map, goals, walkableWithWalls);
+
+    auto spans = findUnreachableSpans(map, walkableWithWalls);
+
+    // One span per row covering x = 6..9
+    ASSERT_EQ(spans.size(), static_cast<size_t>(mapHeight));
+    for (int y = 0; y < mapHeight; ++y) {
+        EXPECT_EQ(spans[y].y, y);
+        EXPECT_EQ(spans[y].xBegin, 6);
+        EXPECT_EQ(spans[y].xEnd, mapWidth);
+    }
+}
+
+TEST_F(DijkstraMapAPITest, UnreachableSpansSplitAroundWalls) {
+    DijkstraMap map(mapWidth, mapHeight, DistanceType::Manhattan);
+    CoordList goals = {};
+
+    generateDijkstraMap(map, goals, centerBlocked);
+
+    auto spans = findUnreachableSpans(map, centerBlocked);
+
+    // Row 5 is split in two by the blocked center tile
+    ASSERT_EQ(spans.size(), static_cast<size_t>(mapHeight + 1));
+    EXPECT_EQ(spans[5].y, 5);
+    EXPECT_EQ(spans[5].xEnd, 5);
+    EXPECT_EQ(spans[6].y, 5);
+    EXPECT_EQ(spans[6].xBegin, 6);
+}
+
+TEST_F(DijkstraMapAPITest, MarkUnreachableTilesBitmap) {
+    DijkstraMap map(mapWidth, mapHeight, DistanceType::Manhattan);
+    CoordList goals = {{0, 0}};
+
+    generateDijkstraMap(map, goals, walkableWithWalls);
+
+    // Start with a stale bitmap of the wrong size
+    BitGrid unreachable(3, 3);
+    unreachable.set(0, 0);
+    markUnreachableTiles(map, walkableWithWalls, unreachable);
+
+    EXPECT_EQ(unreachable.getDimensions(), map.getDimensions());
+    EXPECT_EQ(unreachable.count(), 40);
+    EXPECT_FALSE(unreachable.get(0, 0));
+    EXPECT_FALSE(unreachable.get(5, 5));
+    EXPECT_TRUE(unreachable.get(9, 9));
+}
+
 // Test with Chebyshev distance (8-directional movement)
 TEST_F(DijkstraMapAPITest, ChebyshevDistanceAllowsDiagonals) {
     DijkstraMap map(mapWidth, mapHeight, DistanceType::Chebyshev);
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for point-to-point search tests
+class PointQueryTest : public ::testing::Test {
+protected:
+    static constexpr int mapWidth = 10;
+    static constexpr int mapHeight = 10;
+
+    // Vertical wall at x=5 with a single gap at y=9
+    static bool walkableWithGap(int x, int y) {
+        return x != 5 || y == 9;
+    }
+
+    // Check that a path only takes single steps of the distance type through walkable tiles
+    template<typename WalkableFunc>
+    static void expectValidPath(const CoordList& path, WalkableFunc isWalkable, DistanceType distType) {
+        const bool diagonal = distType == DistanceType::Chebyshev || distType == DistanceType::Octile;
+        for (std::size_t i = 0; i < path.size(); ++i) {
+            const auto [x, y] = path[i];
+            EXPECT_TRUE(isWalkable(x, y));
+            if (i == 0) {
+                continue;
+            }
+            const auto [previousX, previousY] = path[i - 1];
+            const int dx = std::abs(x - previousX);
+            const int dy = std::abs(y - previousY);
+            EXPECT_TRUE(diagonal ? std::max(dx, dy) == 1 : dx + dy == 1);
+        }
+    }
+};
+
+TEST_F(PointQueryTest, OpenMapDistanceMatchesMetric) {
+    SearchWorkspace workspace(mapWidth, mapHeight);
+
+    EXPECT_EQ(queryDistance(workspace, {0, 0}, {3, 4}, allWalkable, DistanceType::Manhattan), 7);
+    EXPECT_EQ(queryDistance(workspace, {0, 0}, {3, 4}, allWalkable, DistanceType::Chebyshev), 4);
+    EXPECT_EQ(queryDistance(workspace, {0, 0}, {3, 4}, allWalkable, DistanceType::Octile), 5242);
+    EXPECT_EQ(queryDistance(workspace, {2, 2}, {2, 2}, allWalkable), 0);
+}
+
+TEST_F(PointQueryTest, DetoursAroundWall) {
+    SearchWorkspace workspace(mapWidth, mapHeight);
+
+    // Down to the gap at (5,9), through it and back up: 9 + 2 + 9 steps
+    EXPECT_EQ(queryDistance(workspace, {4, 0}, {6, 0}, walkableWithGap, DistanceType::Manhattan), 20);
+
+    CoordList path = findPath(workspace, {4, 0}, {6, 0}, walkableWithGap, DistanceType::Manhattan);
+    ASSERT_EQ(path.size(), 21u);
+    EXPECT_EQ(path.front(), Coord(4, 0));
+    EXPECT_EQ(path.back(), Coord(6, 0));
+    EXPECT_TRUE(std::find(path.begin(), path.end(), Coord(5, 9)) != path.end());
+    expectValidPath(path, walkableWithGap, DistanceType::Manhattan);
+}
+
+TEST_F(PointQueryTest, BlockedEndpointsAreUnreachable) {
+    SearchWorkspace workspace(mapWidth, mapHeight);
+    auto walkableWithWall = [](int x, int) {
+        return x != 5;
+    };
+
+    EXPECT_EQ(queryDistance(workspace, {0, 0}, {9, 9}, walkableWithWall), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistance(workspace, {0, 0}, {5, 5}, walkableWithWall), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistance(workspace, {-1, 0}, {1, 1}, allWalkable), DijkstraMap::UNREACHABLE);
+    EXPECT_TRUE(findPath(workspace, {0, 0}, {9, 9}, walkableWithWall).empty());
+}
+
+TEST_F(PointQueryTest, MatchesDijkstraMapOnCave) {
+    constexpr int size = 60;
+    SearchWorkspace workspace(size, size);
+    const Coord goal = {50, 50};
+    const CoordList starts = {{3, 7}, {10, 40}, {57, 2}, {30, 30}, {49, 51}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Euclidean,
+                                  DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap map(size, size, distType);
+        generateDijkstraMap(map, {goal}, scatteredWalls);
+
+        for (const auto& [startX, startY] : starts) {
+            const int expected = map.getDistance(startX, startY);
+            EXPECT_EQ(queryDistance(workspace, {startX, startY}, goal, scatteredWalls, distType), expected);
+
+            CoordList path = findPath(workspace, {startX, startY}, goal, scatteredWalls, distType);
+            if (expected == DijkstraMap::UNREACHABLE) {
+                EXPECT_TRUE(path.empty());
+                continue;
+            }
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.front(), Coord(startX, startY));
+            EXPECT_EQ(path.back(), goal);
+            expectValidPath(path, scatteredWalls, distType);
+        }
+    }
+}
+
+TEST_F(PointQueryTest, ExpandsOnlyTilesNearStraightLine) {
+    constexpr int size = 100;
+    SearchWorkspace workspace(size, size);
+
+    EXPECT_EQ(queryDistance(workspace, {0, 50}, {99, 50}, allWalkable, DistanceType::Octile), 99000);
+    EXPECT_LE(workspace.getExpansionCount(), 2 * size);
+}
+
+TEST_F(PointQueryTest, WorkspaceResetForgetsPreviousSearch) {
+    SearchWorkspace workspace(mapWidth, mapHeight);
+
+    queryDistance(workspace, {0, 0}, {9, 9}, allWalkable, DistanceType::Manhattan);
+    EXPECT_EQ(workspace.getDistance(9, 9), 18);
+
+    workspace.reset();
+    EXPECT_EQ(workspace.getDistance(9, 9), SearchWorkspace::UNREACHABLE);
+    EXPECT_EQ(workspace.getParentIndex(9, 9), SearchWorkspace::NO_PARENT);
+    EXPECT_TRUE(workspace.empty());
+    EXPECT_EQ(workspace.getExpansionCount(), 0);
+}
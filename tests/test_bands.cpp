@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for distance band tests
+class DistanceBandTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 40;
+
+    // Tiles of a band found by reading every distance, in scan order
+    static CoordList scanBand(const DijkstraMap& map, int minDistance, int maxDistance) {
+        CoordList tiles;
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                const int distance = map.getDistance(x, y);
+                if (map.isReachable(x, y) && distance >= minDistance && distance <= maxDistance) {
+                    tiles.emplace_back(x, y);
+                }
+            }
+        }
+        return tiles;
+    }
+
+    static CoordList sorted(CoordList tiles) {
+        std::sort(tiles.begin(), tiles.end(), [](const Coord& a, const Coord& b) {
+            const auto [ax, ay] = a;
+            const auto [bx, by] = b;
+            return std::tie(ay, ax) < std::tie(by, bx);
+        });
+        return tiles;
+    }
+};
+
+TEST_F(DistanceBandTest, SettleOrderMatchesFloodFill) {
+    const CoordList goals = {{5, 5}, {33, 20}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap expected(mapSize, mapSize, distType);
+        generateDijkstraMap(expected, goals, scatteredWalls);
+
+        DijkstraMap actual(mapSize, mapSize, distType);
+        SettleOrder settleOrder(mapSize, mapSize);
+        generateDijkstraMap(actual, goals, scatteredWalls, settleOrder);
+
+        int reachableCount = 0;
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y)) << "at " << x << "," << y;
+                reachableCount += expected.isReachable(x, y);
+            }
+        }
+
+        // Every reachable tile is settled once, in nondecreasing distance
+        ASSERT_EQ(settleOrder.getTileCount(), reachableCount);
+        for (int index = 1; index < settleOrder.getTileCount(); ++index) {
+            const auto [x, y] = settleOrder.getTile(index);
+            const auto [previousX, previousY] = settleOrder.getTile(index - 1);
+            ASSERT_GE(actual.getDistance(x, y), actual.getDistance(previousX, previousY));
+        }
+    }
+}
+
+TEST_F(DistanceBandTest, SettleOrderBandsMatchScan) {
+    DijkstraMap map(mapSize, mapSize, DistanceType::Octile);
+    SettleOrder settleOrder(mapSize, mapSize);
+    generateDijkstraMap(map, {{20, 21}}, scatteredWalls, settleOrder);
+
+    for (const auto& [minDistance, maxDistance] : std::vector<std::tuple<int, int>>{
+             {0, 0}, {5000, 5000}, {5000, 9000}, {-10, 3000}, {12345, 12345}, {30000, DijkstraMap::UNREACHABLE}}) {
+        EXPECT_EQ(sorted(findTilesInBand(settleOrder, minDistance, maxDistance)),
+                  scanBand(map, minDistance, maxDistance))
+            << "band " << minDistance << ".." << maxDistance;
+    }
+
+    EXPECT_EQ(findTilesInBand(settleOrder, 0, 0), CoordList({{20, 21}}));
+    EXPECT_TRUE(findTilesInBand(settleOrder, 9000, 5000).empty());
+    EXPECT_GT(settleOrder.getLevelCount(), 1);
+
+    settleOrder.clear();
+    EXPECT_EQ(settleOrder.getTileCount(), 0);
+    EXPECT_TRUE(findTilesInBand(settleOrder, 0, 1000).empty());
+}
+
+TEST_F(DistanceBandTest, BandScanMatchesGetDistance) {
+    DijkstraMap map(mapSize, mapSize, DistanceType::Manhattan);
+    generateDijkstraMap(map, {{3, 7}}, scatteredWalls);
+
+    for (const auto& [minDistance, maxDistance] : std::vector<std::tuple<int, int>>{
+             {0, 0}, {10, 10}, {10, 20}, {-5, 4}, {30, DijkstraMap::UNREACHABLE}, {1000, 2000}}) {
+        EXPECT_EQ(findTilesInBand(map, minDistance, maxDistance), scanBand(map, minDistance, maxDistance))
+            << "band " << minDistance << ".." << maxDistance;
+    }
+    EXPECT_TRUE(findTilesInBand(map, 20, 10).empty());
+}
+
+TEST_F(DistanceBandTest, BandSpansCoverWholeRows) {
+    DijkstraMap map(70, 3, DistanceType::Chebyshev);
+    generateDijkstraMap(map, {{0, 1}}, [](int, int) { return true; });
+
+    // Columns 65..69 sit at distance 65..69 on all three rows
+    std::vector<TileSpan> spans = findBandSpans(map, 65, 100);
+    ASSERT_EQ(spans.size(), 3u);
+    for (int y = 0; y < 3; ++y) {
+        EXPECT_EQ(spans[y].y, y);
+        EXPECT_EQ(spans[y].xBegin, 65);
+        EXPECT_EQ(spans[y].xEnd, 70);
+    }
+
+    // Only the goal is at distance 0
+    spans = findBandSpans(map, 0, 0);
+    ASSERT_EQ(spans.size(), 1u);
+    EXPECT_EQ(spans[0].y, 1);
+    EXPECT_EQ(spans[0].xBegin, 0);
+    EXPECT_EQ(spans[0].xEnd, 1);
+}
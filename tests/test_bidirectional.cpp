@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for bidirectional point query tests
+class BidirectionalQueryTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 60;
+
+    // Uneven terrain: costs 1 to 4 and some free tiles, a third of the cave walls
+    static int terrainCost(int x, int y) {
+        if (!scatteredWalls(x, y)) {
+            return (x + y) % 2 == 0 ? -1 : 3;
+        }
+        return (x * 7 + y * 13) % 5;
+    }
+};
+
+TEST_F(BidirectionalQueryTest, MatchesDijkstraMapOnCave) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+    const CoordList starts = {{3, 7}, {10, 40}, {57, 2}, {30, 30}, {49, 51}, {50, 50}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Euclidean,
+                                  DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap map(mapSize, mapSize, distType);
+        generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+        for (const auto& [startX, startY] : starts) {
+            EXPECT_EQ(queryDistanceBidirectional(forward, backward, {startX, startY}, {50, 50}, scatteredWalls, distType),
+                      map.getDistance(startX, startY));
+        }
+    }
+}
+
+TEST_F(BidirectionalQueryTest, WeightedMatchesWeightedMap) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Octile}) {
+        DijkstraMap map(mapSize, mapSize, distType);
+        generateWeightedDijkstraMap(map, {{50, 50}}, terrainCost);
+
+        for (int y = 0; y < mapSize; y += 3) {
+            for (int x = 0; x < mapSize; x += 3) {
+                ASSERT_EQ(queryWeightedDistanceBidirectional(forward, backward, {x, y}, {50, 50}, terrainCost, distType),
+                          map.getDistance(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(BidirectionalQueryTest, ExploresAboutHalfOfOneSidedSearch) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+
+    EXPECT_EQ(queryDistanceBidirectional(forward, backward, {10, 30}, {50, 30}, allWalkable, DistanceType::Manhattan), 40);
+
+    // One search of radius 40 would cover most of the map; two of radius 20 cover far less
+    const int explored = forward.getExpansionCount() + backward.getExpansionCount();
+    EXPECT_LT(explored, mapSize * mapSize / 2);
+}
+
+TEST_F(BidirectionalQueryTest, BlockedEndpointsAreUnreachable) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+    auto walkableWithWall = [](int x, int) {
+        return x != 30;
+    };
+
+    EXPECT_EQ(queryDistanceBidirectional(forward, backward, {0, 0}, {59, 59}, walkableWithWall), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistanceBidirectional(forward, backward, {0, 0}, {30, 5}, walkableWithWall), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistanceBidirectional(forward, backward, {4, 4}, {4, 4}, walkableWithWall), 0);
+    EXPECT_EQ(queryWeightedDistanceBidirectional(forward, backward, {-1, 0}, {4, 4}, terrainCost), DijkstraMap::UNREACHABLE);
+}
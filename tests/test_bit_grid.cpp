@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "classes/BitGrid/BitGrid.hpp"
+
+// Test fixture for BitGrid tests; wide enough to span several words per row
+class BitGridTest : public ::testing::Test {
+protected:
+    static constexpr int testWidth = 150;
+    static constexpr int testHeight = 4;
+};
+
+TEST_F(BitGridTest, ConstructorInitializesCleared) {
+    BitGrid grid(testWidth, testHeight);
+    auto [width, height] = grid.getDimensions();
+
+    EXPECT_EQ(width, testWidth);
+    EXPECT_EQ(height, testHeight);
+    EXPECT_EQ(grid.getWordsPerRow(), 3);
+    EXPECT_EQ(grid.count(), 0);
+}
+
+TEST_F(BitGridTest, SetAndGetBits) {
+    BitGrid grid(testWidth, testHeight);
+
+    grid.set(0, 0);
+    grid.set(63, 1);
+    grid.set(64, 1);
+    grid.set(149, 3);
+
+    EXPECT_TRUE(grid.get(0, 0));
+    EXPECT_TRUE(grid.get(63, 1));
+    EXPECT_TRUE(grid.get(64, 1));
+    EXPECT_TRUE(grid.get(149, 3));
+    EXPECT_FALSE(grid.get(1, 0));
+    EXPECT_EQ(grid.count(), 4);
+
+    grid.set(63, 1, false);
+    EXPECT_FALSE(grid.get(63, 1));
+    EXPECT_EQ(grid.count(), 3);
+}
+
+TEST_F(BitGridTest, OutOfBoundsIsIgnored) {
+    BitGrid grid(testWidth, testHeight);
+
+    grid.set(-1, 0);
+    grid.set(testWidth, 0);
+    grid.set(0, testHeight);
+
+    EXPECT_EQ(grid.count(), 0);
+    EXPECT_FALSE(grid.get(-1, 0));
+    EXPECT_FALSE(grid.get(testWidth, 0));
+}
+
+TEST_F(BitGridTest, SetSpanAcrossWordBoundaries) {
+    BitGrid grid(testWidth, testHeight);
+
+    grid.setSpan(2, 60, 130);
+    EXPECT_EQ(grid.count(), 70);
+    EXPECT_FALSE(grid.get(59, 2));
+    EXPECT_TRUE(grid.get(60, 2));
+    EXPECT_TRUE(grid.get(129, 2));
+    EXPECT_FALSE(grid.get(130, 2));
+
+    // Spans are clipped to the row
+    grid.clear();
+    grid.setSpan(0, -10, testWidth + 10);
+    EXPECT_EQ(grid.count(), testWidth);
+    EXPECT_EQ(grid.getRow(0)[2], grid.getLastWordMask());
+}
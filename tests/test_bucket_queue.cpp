@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include "classes/BucketQueue/BucketQueue.hpp"
+
+TEST(BucketQueueTest, PopsInDistanceOrder) {
+    BucketQueue queue(3);
+
+    queue.push(0, 10);
+    queue.push(2, 12);
+    queue.push(1, 11);
+    EXPECT_EQ(queue.size(), 3u);
+
+    auto [firstDistance, firstIndex] = queue.pop();
+    EXPECT_EQ(firstDistance, 0);
+    EXPECT_EQ(firstIndex, 10);
+
+    // Pushing relative to the current distance wraps around the ring
+    queue.push(3, 13);
+    EXPECT_EQ(std::get<0>(queue.pop()), 1);
+    EXPECT_EQ(std::get<0>(queue.pop()), 2);
+    EXPECT_EQ(std::get<1>(queue.pop()), 13);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(BucketQueueTest, ClearRestartsAtZero) {
+    BucketQueue queue(1);
+
+    queue.push(0, 1);
+    queue.pop();
+    queue.push(1, 2);
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+
+    queue.push(0, 5);
+    auto [distance, index] = queue.pop();
+    EXPECT_EQ(distance, 0);
+    EXPECT_EQ(index, 5);
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for hierarchical (chunked) Dijkstra map tests
+class ChunkHierarchyTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 64;
+    static constexpr int chunkSize = 16;
+
+    static void expectSameHierarchy(const ChunkHierarchy& expected, const ChunkHierarchy& actual) {
+        const auto [chunksX, chunksY] = expected.getChunkCounts();
+        for (int chunkY = 0; chunkY < chunksY; ++chunkY) {
+            for (int chunkX = 0; chunkX < chunksX; ++chunkX) {
+                EXPECT_TRUE(expected.getEntrances(chunkX, chunkY) == actual.getEntrances(chunkX, chunkY));
+                EXPECT_TRUE(expected.getDistanceTable(chunkX, chunkY) == actual.getDistanceTable(chunkX, chunkY));
+            }
+        }
+    }
+};
+
+TEST_F(ChunkHierarchyTest, OpenBordersGetCrossingsAtBothEnds) {
+    ChunkHierarchy hierarchy = buildChunkHierarchy(32, 16, chunkSize, allWalkable, DistanceType::Manhattan);
+
+    const auto& crossings = hierarchy.getEastCrossings(0, 0);
+    ASSERT_EQ(crossings.size(), 2u);
+    EXPECT_EQ(crossings[0].x, 15);
+    EXPECT_EQ(crossings[0].y, 0);
+    EXPECT_EQ(crossings[0].otherX, 16);
+    EXPECT_EQ(crossings[1].y, 15);
+    EXPECT_TRUE(hierarchy.getSouthCrossings(0, 0).empty());
+    EXPECT_EQ(hierarchy.getEntranceCount(1, 0), 2);
+
+    // In-chunk distance between the two entrances of chunk 0
+    EXPECT_EQ(hierarchy.getDistanceTable(0, 0)[1], 15);
+}
+
+TEST_F(ChunkHierarchyTest, DistancesAreRealPathLengths) {
+    CoordList goals = {{5, 5}, {50, 40}};
+
+    for (bool (*isWalkable)(int, int) : {allWalkable, scatteredWalls}) {
+        for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+            ChunkHierarchy hierarchy = buildChunkHierarchy(mapSize, mapSize, chunkSize, isWalkable, distType);
+            HierarchicalDijkstraMap hierarchicalMap = generateHierarchicalDijkstraMap(hierarchy, goals, isWalkable);
+
+            DijkstraMap exact(mapSize, mapSize, distType);
+            generateDijkstraMap(exact, goals, isWalkable);
+
+            for (int y = 0; y < mapSize; ++y) {
+                for (int x = 0; x < mapSize; ++x) {
+                    const int distance = getHierarchicalDistance(hierarchicalMap, hierarchy, x, y, isWalkable);
+                    if (!exact.isReachable(x, y)) {
+                        EXPECT_EQ(distance, DijkstraMap::UNREACHABLE);
+                    } else {
+                        ASSERT_NE(distance, DijkstraMap::UNREACHABLE) << "at " << x << "," << y;
+                        EXPECT_GE(distance, exact.getDistance(x, y));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(ChunkHierarchyTest, ChunksTouchingDiagonallyAreConnected) {
+    // Two open quadrants meeting only at the corner (3, 3)-(4, 4)
+    auto quadrants = [](int x, int y) {
+        return (x < 4) == (y < 4);
+    };
+    // Chunks (0, 0) and (1, 0) joined only by the diagonal step (3, 1)-(4, 2)
+    auto diagonalGap = [](int x, int y) {
+        return y < 4 && (x < 4 ? y <= 1 : y >= 2);
+    };
+
+    for (DistanceType distType : {DistanceType::Chebyshev, DistanceType::Octile}) {
+        ChunkHierarchy hierarchy = buildChunkHierarchy(8, 8, 4, quadrants, distType);
+        EXPECT_EQ(hierarchy.getSouthEastCrossings(0, 0).size(), 1u);
+        HierarchicalDijkstraMap hierarchicalMap = generateHierarchicalDijkstraMap(hierarchy, {{0, 0}}, quadrants);
+
+        DijkstraMap exact(8, 8, distType);
+        generateDijkstraMap(exact, {{0, 0}}, quadrants);
+        EXPECT_EQ(getHierarchicalDistance(hierarchicalMap, hierarchy, 6, 6, quadrants), exact.getDistance(6, 6));
+        EXPECT_EQ(getHierarchicalDistance(hierarchicalMap, hierarchy, 2, 6, quadrants), DijkstraMap::UNREACHABLE);
+
+        ChunkHierarchy gapHierarchy = buildChunkHierarchy(8, 4, 4, diagonalGap, distType);
+        ASSERT_EQ(gapHierarchy.getEastCrossings(0, 0).size(), 1u);
+        EXPECT_EQ(gapHierarchy.getEastCrossings(0, 0)[0].otherY, 2);
+        HierarchicalDijkstraMap gapMap = generateHierarchicalDijkstraMap(gapHierarchy, {{0, 0}}, diagonalGap);
+
+        DijkstraMap gapExact(8, 4, distType);
+        generateDijkstraMap(gapExact, {{0, 0}}, diagonalGap);
+        EXPECT_EQ(getHierarchicalDistance(gapMap, gapHierarchy, 7, 3, diagonalGap), gapExact.getDistance(7, 3));
+    }
+
+    // Without diagonal movement the quadrants stay apart
+    ChunkHierarchy manhattan = buildChunkHierarchy(8, 8, 4, quadrants, DistanceType::Manhattan);
+    EXPECT_TRUE(manhattan.getSouthEastCrossings(0, 0).empty());
+    HierarchicalDijkstraMap manhattanMap = generateHierarchicalDijkstraMap(manhattan, {{0, 0}}, quadrants);
+    EXPECT_EQ(getHierarchicalDistance(manhattanMap, manhattan, 6, 6, quadrants), DijkstraMap::UNREACHABLE);
+}
+
+TEST_F(ChunkHierarchyTest, NonPositiveChunkSizeIsClampedToOne) {
+    for (int badChunkSize : {0, -3}) {
+        ChunkHierarchy hierarchy = buildChunkHierarchy(5, 4, badChunkSize, allWalkable, DistanceType::Manhattan);
+        EXPECT_EQ(hierarchy.getChunkSize(), 1);
+        EXPECT_EQ(hierarchy.getChunkCounts(), std::make_tuple(5, 4));
+
+        HierarchicalDijkstraMap hierarchicalMap = generateHierarchicalDijkstraMap(hierarchy, {{0, 0}}, allWalkable);
+        EXPECT_EQ(getHierarchicalDistance(hierarchicalMap, hierarchy, 4, 3, allWalkable), 7);
+    }
+}
+
+TEST_F(ChunkHierarchyTest, OpenMapIsFullyReachableWithBoundedDetours) {
+    ChunkHierarchy hierarchy = buildChunkHierarchy(mapSize, mapSize, chunkSize, allWalkable, DistanceType::Octile);
+    HierarchicalDijkstraMap hierarchicalMap = generateHierarchicalDijkstraMap(hierarchy, {{30, 30}}, allWalkable);
+
+    DijkstraMap exact(mapSize, mapSize, DistanceType::Octile);
+    generateDijkstraMap(exact, {{30, 30}}, allWalkable);
+
+    for (int y = 0; y < mapSize; ++y) {
+        for (int x = 0; x < mapSize; ++x) {
+            const int distance = getHierarchicalDistance(hierarchicalMap, hierarchy, x, y, allWalkable);
+            ASSERT_NE(distance, DijkstraMap::UNREACHABLE);
+            EXPECT_LE(distance, exact.getDistance(x, y) * 3 / 2 + 2 * chunkSize * DijkstraMap::OCTILE_ORTHOGONAL_COST);
+        }
+    }
+    EXPECT_EQ(hierarchicalMap.getDistance(30, 30), 0);
+}
+
+TEST_F(ChunkHierarchyTest, ChunksAreRefinedLazily) {
+    ChunkHierarchy hierarchy = buildChunkHierarchy(mapSize, mapSize, chunkSize, allWalkable);
+    HierarchicalDijkstraMap hierarchicalMap = generateHierarchicalDijkstraMap(hierarchy, {{1, 1}}, allWalkable);
+
+    EXPECT_FALSE(hierarchicalMap.isChunkRefined(3, 3));
+    EXPECT_EQ(hierarchicalMap.getDistance(60, 60), DijkstraMap::UNREACHABLE);
+
+    const int distance = getHierarchicalDistance(hierarchicalMap, hierarchy, 60, 60, allWalkable);
+    EXPECT_TRUE(hierarchicalMap.isChunkRefined(3, 3));
+    EXPECT_FALSE(hierarchicalMap.isChunkRefined(2, 3));
+    EXPECT_EQ(hierarchicalMap.getDistance(60, 60), distance);
+}
+
+TEST_F(ChunkHierarchyTest, WallSeparatesChunks) {
+    auto walkableWithWall = [](int x, int) {
+        return x != 20;
+    };
+
+    ChunkHierarchy hierarchy = buildChunkHierarchy(mapSize, mapSize, chunkSize, walkableWithWall);
+    HierarchicalDijkstraMap hierarchicalMap = generateHierarchicalDijkstraMap(hierarchy, {{2, 2}}, walkableWithWall);
+
+    EXPECT_NE(getHierarchicalDistance(hierarchicalMap, hierarchy, 19, 63, walkableWithWall), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(getHierarchicalDistance(hierarchicalMap, hierarchy, 21, 0, walkableWithWall), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(getHierarchicalDistance(hierarchicalMap, hierarchy, 63, 63, walkableWithWall), DijkstraMap::UNREACHABLE);
+}
+
+TEST_F(ChunkHierarchyTest, UpdateMatchesRebuild) {
+    std::vector<bool> walkable(mapSize * mapSize);
+    for (int y = 0; y < mapSize; ++y) {
+        for (int x = 0; x < mapSize; ++x) {
+            walkable[y * mapSize + x] = scatteredWalls(x, y);
+        }
+    }
+    auto isWalkable = [&walkable](int x, int y) {
+        return static_cast<bool>(walkable[y * mapSize + x]);
+    };
+
+    ChunkHierarchy hierarchy = buildChunkHierarchy(mapSize, mapSize, chunkSize, isWalkable, DistanceType::Chebyshev);
+
+    // Open up the whole of chunk (1, 2), including its borders
+    for (int y = 2 * chunkSize; y < 3 * chunkSize; ++y) {
+        for (int x = chunkSize; x < 2 * chunkSize; ++x) {
+            walkable[y * mapSize + x] = true;
+        }
+    }
+    updateChunkHierarchy(hierarchy, 1, 2, isWalkable);
+
+    ChunkHierarchy rebuilt = buildChunkHierarchy(mapSize, mapSize, chunkSize, isWalkable, DistanceType::Chebyshev);
+    expectSameHierarchy(rebuilt, hierarchy);
+}
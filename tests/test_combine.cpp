@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for map combination tests
+class CombineMapsTest : public ::testing::Test {
+protected:
+    // Not a multiple of the kernel's block size, so rows end in a partial block
+    static constexpr int mapWidth = 75;
+    static constexpr int mapHeight = 37;
+
+    static DijkstraMap makeMap(const CoordList& goals, int width = mapWidth, int height = mapHeight) {
+        DijkstraMap map(width, height, DistanceType::Octile);
+        generateDijkstraMap(map, goals, scatteredWalls);
+        return map;
+    }
+
+    // Weighted sum read through getDistance, rounded with std::nearbyint
+    static int referenceDistance(const std::vector<WeightedMap>& terms, int x, int y) {
+        double sum = 0.0;
+        for (const WeightedMap& term : terms) {
+            if (!term.map.isReachable(x, y)) {
+                return DijkstraMap::UNREACHABLE;
+            }
+            sum += term.weight * term.map.getDistance(x, y);
+        }
+        const double rounded = std::nearbyint(sum);
+        return static_cast<int>(std::max(static_cast<double>(CombinedMapView::LOWEST_DISTANCE),
+                                         std::min(static_cast<double>(CombinedMapView::HIGHEST_DISTANCE), rounded)));
+    }
+};
+
+TEST_F(CombineMapsTest, MatchesPerTileSum) {
+    const DijkstraMap goalMap = makeMap({{5, 5}});
+    const DijkstraMap fleeMap = makeMap({{60, 30}, {40, 10}});
+    const DijkstraMap dangerMap = makeMap({{21, 25}});
+    const std::vector<WeightedMap> terms = {{goalMap, 1.0}, {fleeMap, -1.2}, {dangerMap, 0.5}};
+
+    DijkstraMap combined(mapWidth, mapHeight, DistanceType::Octile);
+    combineMaps(combined, terms);
+    const CombinedMapView view(terms);
+
+    EXPECT_EQ(view.getDimensions(), combined.getDimensions());
+    int reachableCount = 0;
+    for (int y = 0; y < mapHeight; ++y) {
+        for (int x = 0; x < mapWidth; ++x) {
+            const int expected = referenceDistance(terms, x, y);
+            ASSERT_EQ(combined.getDistance(x, y), expected) << "at " << x << "," << y;
+            ASSERT_EQ(view.getDistance(x, y), expected) << "at " << x << "," << y;
+            reachableCount += view.isReachable(x, y);
+        }
+    }
+    EXPECT_GT(reachableCount, 0);
+    EXPECT_EQ(view.getDistance(-1, 0), DijkstraMap::UNREACHABLE);
+}
+
+TEST_F(CombineMapsTest, SaturatesRoundsAndKeepsUnreachable) {
+    DijkstraMap first(4, 1);
+    DijkstraMap second(4, 1);
+    const int firstDistances[] = {1, 3, 5, 2000000000};
+    for (int x = 0; x < 4; ++x) {
+        first.setDistance(x, 0, firstDistances[x]);
+        second.setDistance(x, 0, 0);
+    }
+
+    // Halves round to even
+    DijkstraMap combined(4, 1);
+    combineMaps(combined, {{first, 0.5}});
+    EXPECT_EQ(combined.getDistance(0, 0), 0);
+    EXPECT_EQ(combined.getDistance(1, 0), 2);
+    EXPECT_EQ(combined.getDistance(2, 0), 2);
+
+    // Sums beyond the int range saturate without reaching UNREACHABLE
+    combineMaps(combined, {{first, 4.0}, {second, 1.0}});
+    EXPECT_EQ(combined.getDistance(3, 0), CombinedMapView::HIGHEST_DISTANCE);
+    combineMaps(combined, {{first, -4.0}});
+    EXPECT_EQ(combined.getDistance(3, 0), CombinedMapView::LOWEST_DISTANCE);
+
+    // Unreachable in any term, even with weight 0, is unreachable
+    second.setDistance(1, 0, DijkstraMap::UNREACHABLE);
+    combineMaps(combined, {{first, 1.0}, {second, 0.0}});
+    EXPECT_EQ(combined.getDistance(0, 0), 1);
+    EXPECT_EQ(combined.getDistance(1, 0), DijkstraMap::UNREACHABLE);
+    EXPECT_FALSE(CombinedMapView({{first, 1.0}, {second, 0.0}}).isReachable(1, 0));
+
+    // No terms leave every tile unreachable, as in an empty view
+    combineMaps(combined, {});
+    const CombinedMapView emptyView({});
+    for (int x = 0; x < 4; ++x) {
+        EXPECT_EQ(combined.getDistance(x, 0), DijkstraMap::UNREACHABLE);
+        EXPECT_EQ(emptyView.getDistance(x, 0), DijkstraMap::UNREACHABLE);
+    }
+    EXPECT_EQ(combined.getDimensions(), std::make_tuple(4, 1));
+}
+
+TEST_F(CombineMapsTest, OutputMayBeATerm) {
+    DijkstraMap goalMap = makeMap({{5, 5}});
+    const DijkstraMap originalGoalMap = goalMap;
+    const DijkstraMap fleeMap = makeMap({{60, 30}});
+
+    combineMaps(goalMap, {{goalMap, 2.0}, {fleeMap, -1.0}});
+
+    const std::vector<WeightedMap> terms = {{originalGoalMap, 2.0}, {fleeMap, -1.0}};
+    for (int y = 0; y < mapHeight; ++y) {
+        for (int x = 0; x < mapWidth; ++x) {
+            ASSERT_EQ(goalMap.getDistance(x, y), referenceDistance(terms, x, y)) << "at " << x << "," << y;
+        }
+    }
+}
+
+TEST_F(CombineMapsTest, SmallerTermsLeaveTilesUnreachable) {
+    const DijkstraMap goalMap = makeMap({{5, 5}});
+    const DijkstraMap smallMap = makeMap({{5, 5}}, 30, 20);
+
+    DijkstraMap combined(mapWidth, mapHeight, DistanceType::Octile);
+    combineMaps(combined, {{goalMap, 1.0}, {smallMap, 1.0}});
+
+    EXPECT_EQ(combined.getDimensions(), std::make_tuple(mapWidth, mapHeight));
+    for (int y = 0; y < mapHeight; ++y) {
+        for (int x = 0; x < mapWidth; ++x) {
+            const int expected = (x < 30 && y < 20) ? referenceDistance({{goalMap, 1.0}, {smallMap, 1.0}}, x, y)
+                                                    : DijkstraMap::UNREACHABLE;
+            ASSERT_EQ(combined.getDistance(x, y), expected) << "at " << x << "," << y;
+        }
+    }
+    EXPECT_EQ(combined.getDistance(5, 5), 0);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for connected-component labeling tests
+class ComponentLabelsTest : public ::testing::Test {
+protected:
+    static constexpr int mapWidth = 10;
+    static constexpr int mapHeight = 10;
+
+    // Vertical wall at x=5 splits the map into two rooms
+    static bool walkableWithWall(int x, int) {
+        return x != 5;
+    }
+};
+
+TEST_F(ComponentLabelsTest, OpenMapIsSingleComponent) {
+    ComponentLabels components = labelComponents(mapWidth, mapHeight, allWalkable);
+
+    EXPECT_EQ(components.getComponentCount(), 1);
+    EXPECT_EQ(components.getComponentSize(0), mapWidth * mapHeight);
+    EXPECT_TRUE(components.isSameComponent(0, 0, 9, 9));
+}
+
+TEST_F(ComponentLabelsTest, WallSplitsMapIntoTwoComponents) {
+    ComponentLabels components = labelComponents(mapWidth, mapHeight, walkableWithWall);
+
+    EXPECT_EQ(components.getComponentCount(), 2);
+    EXPECT_EQ(components.getLabel(5, 5), ComponentLabels::NO_COMPONENT);
+    EXPECT_TRUE(components.isSameComponent(0, 0, 4, 9));
+    EXPECT_FALSE(components.isSameComponent(0, 0, 6, 0));
+    EXPECT_EQ(components.getComponentSize(components.getLabel(0, 0)), 50);
+    EXPECT_EQ(components.getComponentSize(components.getLabel(9, 9)), 40);
+}
+
+TEST_F(ComponentLabelsTest, DiagonalConnectivityFollowsDistanceType) {
+    // Only the main diagonal is walkable
+    auto diagonalOnly = [](int x, int y) {
+        return x == y;
+    };
+
+    ComponentLabels fourConnected = labelComponents(mapWidth, mapHeight, diagonalOnly, DistanceType::Manhattan);
+    ComponentLabels eightConnected = labelComponents(mapWidth, mapHeight, diagonalOnly, DistanceType::Chebyshev);
+
+    EXPECT_EQ(fourConnected.getComponentCount(), mapWidth);
+    EXPECT_EQ(eightConnected.getComponentCount(), 1);
+}
+
+TEST_F(ComponentLabelsTest, MergesComponentsJoinedLaterInScan) {
+    // U shape: two vertical arms only joined by the bottom row
+    auto uShape = [](int x, int y) {
+        return x == 0 || x == 9 || y == 9;
+    };
+
+    ComponentLabels components = labelComponents(mapWidth, mapHeight, uShape);
+
+    EXPECT_EQ(components.getComponentCount(), 1);
+    EXPECT_TRUE(components.isSameComponent(0, 0, 9, 0));
+}
+
+TEST_F(ComponentLabelsTest, ReachabilityFromGoals) {
+    ComponentLabels components = labelComponents(mapWidth, mapHeight, walkableWithWall);
+    CoordList goals = {{0, 0}};
+
+    EXPECT_TRUE(isReachableFromGoals(components, 4, 9, goals));
+    EXPECT_FALSE(isReachableFromGoals(components, 9, 9, goals));
+    EXPECT_FALSE(isReachableFromGoals(components, 5, 5, goals));
+
+    std::vector<int> unreachable = findUnreachableComponents(components, goals);
+    ASSERT_EQ(unreachable.size(), 1u);
+    EXPECT_EQ(unreachable[0], components.getLabel(9, 9));
+}
+
+TEST_F(ComponentLabelsTest, UnreachableTilesMatchDijkstraMap) {
+    constexpr int size = 40;
+    CoordList goals = {{1, 1}, {30, 20}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap map(size, size, distType);
+        generateDijkstraMap(map, goals, scatteredWalls);
+        ComponentLabels components = labelComponents(size, size, scatteredWalls, distType);
+
+        CoordList fromComponents = findUnreachableTiles(components, goals);
+        CoordList fromDistances = findUnreachableTiles(map, scatteredWalls);
+        ASSERT_EQ(fromComponents.size(), fromDistances.size());
+        EXPECT_TRUE(fromComponents == fromDistances);
+    }
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for contraction hierarchy tests
+class ContractionHierarchyTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 40;
+
+    // Vertical wall at x=20 splits the map into two rooms
+    static bool walkableWithWall(int x, int) {
+        return x != 20;
+    }
+};
+
+TEST_F(ContractionHierarchyTest, EdgesPointUpward) {
+    ContractionHierarchy hierarchy = buildContractionHierarchy(mapSize, mapSize, scatteredWalls, DistanceType::Octile, 2);
+
+    int walkableCount = 0;
+    for (int y = 0; y < mapSize; ++y) {
+        for (int x = 0; x < mapSize; ++x) {
+            walkableCount += scatteredWalls(x, y);
+        }
+    }
+    ASSERT_EQ(hierarchy.getNodeCount(), walkableCount);
+
+    for (int node = 0; node < hierarchy.getNodeCount(); ++node) {
+        const auto [x, y] = hierarchy.getNodePosition(node);
+        EXPECT_EQ(hierarchy.getNode(x, y), node);
+
+        const auto [firstEdge, lastEdge] = hierarchy.getEdgeRange(node);
+        for (int edge = firstEdge; edge < lastEdge; ++edge) {
+            EXPECT_GT(hierarchy.getEdge(edge).target, node);
+            EXPECT_LT(hierarchy.getEdge(edge).middle, node);
+        }
+    }
+}
+
+TEST_F(ContractionHierarchyTest, MatchesDijkstraMap) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        for (int threadCount : {1, 3}) {
+            ContractionHierarchy hierarchy = buildContractionHierarchy(mapSize, mapSize, scatteredWalls, distType, threadCount);
+
+            for (const Coord& goal : CoordList{{5, 5}, {33, 20}}) {
+                DijkstraMap map(mapSize, mapSize, distType);
+                generateDijkstraMap(map, {goal}, scatteredWalls);
+
+                for (int y = 0; y < mapSize; y += 3) {
+                    for (int x = 0; x < mapSize; x += 3) {
+                        ASSERT_EQ(queryDistance(forward, backward, hierarchy, {x, y}, goal), map.getDistance(x, y))
+                            << "from " << x << "," << y;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(ContractionHierarchyTest, PathUnpacksShortcutsIntoSteps) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+    ContractionHierarchy hierarchy = buildContractionHierarchy(mapSize, mapSize, scatteredWalls, DistanceType::Octile);
+
+    const int distance = queryDistance(forward, backward, hierarchy, {3, 7}, {33, 20});
+    ASSERT_NE(distance, DijkstraMap::UNREACHABLE);
+
+    CoordList path = findPath(forward, backward, hierarchy, {3, 7}, {33, 20});
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(path.front(), Coord(3, 7));
+    EXPECT_EQ(path.back(), Coord(33, 20));
+
+    int length = 0;
+    for (std::size_t i = 1; i < path.size(); ++i) {
+        const auto [x, y] = path[i];
+        const auto [previousX, previousY] = path[i - 1];
+        EXPECT_TRUE(scatteredWalls(x, y));
+        EXPECT_EQ(std::max(std::abs(x - previousX), std::abs(y - previousY)), 1);
+        length += (x != previousX && y != previousY) ? 1414 : 1000;
+    }
+    EXPECT_EQ(length, distance);
+}
+
+TEST_F(ContractionHierarchyTest, SeparatedOrBlockedEndpoints) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+    ContractionHierarchy hierarchy = buildContractionHierarchy(mapSize, mapSize, walkableWithWall, DistanceType::Manhattan);
+
+    EXPECT_EQ(queryDistance(forward, backward, hierarchy, {0, 0}, {39, 39}), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistance(forward, backward, hierarchy, {0, 0}, {20, 5}), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistance(forward, backward, hierarchy, {0, 0}, {19, 39}), 58);
+    EXPECT_EQ(queryDistance(forward, backward, hierarchy, {4, 4}, {4, 4}), 0);
+    EXPECT_TRUE(findPath(forward, backward, hierarchy, {0, 0}, {39, 39}).empty());
+    EXPECT_EQ(findPath(forward, backward, hierarchy, {4, 4}, {4, 4}).size(), 1u);
+}
+
+TEST_F(ContractionHierarchyTest, SerializationRoundTrip) {
+    SearchWorkspace forward(mapSize, mapSize);
+    SearchWorkspace backward(mapSize, mapSize);
+    ContractionHierarchy hierarchy = buildContractionHierarchy(mapSize, mapSize, scatteredWalls, DistanceType::Octile);
+    const std::vector<std::uint8_t> bytes = hierarchy.serialize();
+
+    // Variable-length numbers take far less than three 32-bit words per edge
+    EXPECT_LT(bytes.size(), static_cast<std::size_t>(hierarchy.getEdgeCount()) * 12);
+
+    ContractionHierarchy loaded(1, 1);
+    ASSERT_TRUE(loaded.deserialize(bytes));
+    EXPECT_EQ(loaded.getDimensions(), hierarchy.getDimensions());
+    EXPECT_EQ(loaded.getDistanceType(), DistanceType::Octile);
+    EXPECT_EQ(loaded.getNodeCount(), hierarchy.getNodeCount());
+    EXPECT_EQ(loaded.getEdgeCount(), hierarchy.getEdgeCount());
+    EXPECT_EQ(loaded.serialize(), bytes);
+    EXPECT_EQ(queryDistance(forward, backward, loaded, {3, 7}, {33, 20}),
+              queryDistance(forward, backward, hierarchy, {3, 7}, {33, 20}));
+}
+
+TEST_F(ContractionHierarchyTest, DeserializeRejectsMalformedBytes) {
+    ContractionHierarchy hierarchy = buildContractionHierarchy(mapSize, mapSize, scatteredWalls, DistanceType::Manhattan);
+    const std::vector<std::uint8_t> bytes = hierarchy.serialize();
+    ContractionHierarchy loaded(3, 3);
+
+    std::vector<std::uint8_t> truncated(bytes.begin(), bytes.end() - 1);
+    std::vector<std::uint8_t> trailing = bytes;
+    trailing.push_back(0);
+    std::vector<std::uint8_t> wrongMagic = bytes;
+    wrongMagic[0] = 'X';
+
+    EXPECT_FALSE(loaded.deserialize(truncated));
+    EXPECT_FALSE(loaded.deserialize(trailing));
+    EXPECT_FALSE(loaded.deserialize(wrongMagic));
+    EXPECT_FALSE(loaded.deserialize({}));
+
+    // Failed loads leave the previous contents alone
+    EXPECT_EQ(loaded.getDimensions(), std::make_tuple(3, 3));
+    EXPECT_EQ(loaded.getNodeCount(), 0);
+}
+
+TEST_F(ContractionHierarchyTest, DeserializeRejectsCorruptedShortcutsAndSizes) {
+    // 3x1 corridor contracted from the middle: node 0 is (1, 0), the shortcut 1-2 passes through it
+    const std::vector<std::uint8_t> header = {'D', 'M', 'C', 'H', 1, 3, 1, 0, 3};
+    const std::vector<std::uint8_t> middleNode = {1, 2, 1, 1, 0, 2, 1, 0};
+    const std::vector<std::uint8_t> endNodes = {0, 1, 1, 2, 1, 2, 0};
+    std::vector<std::uint8_t> valid = header;
+    valid.insert(valid.end(), middleNode.begin(), middleNode.end());
+    valid.insert(valid.end(), endNodes.begin(), endNodes.end());
+
+    ContractionHierarchy loaded(3, 3);
+    ASSERT_TRUE(loaded.deserialize(valid));
+    SearchWorkspace forward(3, 1);
+    SearchWorkspace backward(3, 1);
+    EXPECT_EQ(findPath(forward, backward, loaded, {0, 0}, {2, 0}), CoordList({{0, 0}, {1, 0}, {2, 0}}));
+
+    // Drop the middle node's edge to node 2: the shortcut could not be unpacked
+    std::vector<std::uint8_t> corrupted = header;
+    corrupted.insert(corrupted.end(), {1, 1, 1, 1, 0});
+    corrupted.insert(corrupted.end(), endNodes.begin(), endNodes.end());
+    EXPECT_FALSE(loaded.deserialize(corrupted));
+
+    // A short header must not allocate node IDs for billions of tiles
+    const std::vector<std::uint8_t> huge = {'D', 'M', 'C', 'H', 1, 0xC0, 0xB8, 0x02, 0xC0, 0xB8, 0x02, 0, 0};
+    EXPECT_FALSE(loaded.deserialize(huge));
+    const std::vector<std::uint8_t> tooManyNodes = {'D', 'M', 'C', 'H', 1, 3, 1, 0, 3, 0, 0};
+    EXPECT_FALSE(loaded.deserialize(tooManyNodes));
+
+    EXPECT_EQ(loaded.getDimensions(), std::make_tuple(3, 1));
+    EXPECT_EQ(loaded.getNodeCount(), 3);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for corridor graph tests
+class CorridorGraphTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 31;
+
+    // Serpentine: horizontal corridors joined at alternating ends
+    static bool serpentine(int x, int y) {
+        if (y % 2 == 0) {
+            return true;
+        }
+        return ((y / 2) % 2 == 0) ? x == mapSize - 1 : x == 0;
+    }
+
+    static void expectMatchesFloodFill(const CorridorGraph& graph,
+                                       const std::vector<bool>& walkable,
+                                       const CoordList& goals) {
+        auto isWalkable = [&walkable](int x, int y) {
+            return walkable[y * mapSize + x];
+        };
+
+        DijkstraMap expected(mapSize, mapSize, graph.getDistanceType());
+        DijkstraMap actual(mapSize, mapSize, graph.getDistanceType());
+        generateDijkstraMap(expected, goals, isWalkable);
+        generateDijkstraMapFromCorridorGraph(actual, graph, goals);
+
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+
+    static std::vector<bool> toGrid(bool (*isWalkable)(int, int)) {
+        std::vector<bool> walkable(mapSize * mapSize);
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                walkable[y * mapSize + x] = isWalkable(x, y);
+            }
+        }
+        return walkable;
+    }
+};
+
+TEST_F(CorridorGraphTest, StraightCorridorIsOneChain) {
+    // Single row: the two ends are dead ends (degree 1), everything between is corridor
+    auto row = [](int, int y) {
+        return y == 0;
+    };
+
+    CorridorGraph graph = buildCorridorGraph(10, 3, row, DistanceType::Manhattan);
+
+    EXPECT_NE(graph.getNodeId(0, 0), CorridorGraph::NO_NODE);
+    EXPECT_NE(graph.getNodeId(9, 0), CorridorGraph::NO_NODE);
+    const int chainId = graph.getChainId(5, 0);
+    ASSERT_NE(chainId, CorridorGraph::NO_CHAIN);
+    EXPECT_EQ(graph.getChain(chainId).length, 9);
+    EXPECT_EQ(graph.getChain(chainId).tiles.size(), 8u);
+    EXPECT_EQ(graph.getChainId(5, 1), CorridorGraph::NO_CHAIN);
+}
+
+TEST_F(CorridorGraphTest, ClosedLoopGetsAnchorNode) {
+    // Ring of tiles around a 3x3 block: every tile has exactly two 4-neighbors
+    auto ring = [](int x, int y) {
+        return x == 0 || x == 4 || y == 0 || y == 4;
+    };
+
+    CorridorGraph graph = buildCorridorGraph(5, 5, ring, DistanceType::Manhattan);
+
+    DijkstraMap map(5, 5, DistanceType::Manhattan);
+    generateDijkstraMapFromCorridorGraph(map, graph, {{2, 0}});
+    EXPECT_EQ(map.getDistance(2, 4), 8);
+    EXPECT_EQ(map.getDistance(0, 0), 2);
+    EXPECT_EQ(map.getDistance(4, 3), 5);
+}
+
+TEST_F(CorridorGraphTest, GenerationMatchesFloodFill) {
+    CoordList goals = {{3, 0}, {20, 13}, {5, 30}};
+
+    for (bool (*isWalkable)(int, int) : {serpentine, scatteredWalls}) {
+        for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev,
+                                      DistanceType::Euclidean, DistanceType::Octile}) {
+            CorridorGraph graph = buildCorridorGraph(mapSize, mapSize, isWalkable, distType);
+            expectMatchesFloodFill(graph, toGrid(isWalkable), goals);
+        }
+    }
+}
+
+TEST_F(CorridorGraphTest, IncrementalUpdatesMatchFloodFill) {
+    CoordList goals = {{0, 0}, {17, 22}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Octile}) {
+        for (bool (*initial)(int, int) : {serpentine, scatteredWalls}) {
+            std::vector<bool> walkable = toGrid(initial);
+            auto isWalkable = [&walkable](int x, int y) {
+                return static_cast<bool>(walkable[y * mapSize + x]);
+            };
+            CorridorGraph graph = buildCorridorGraph(mapSize, mapSize, isWalkable, distType);
+
+            // Toggle a pseudo-random sequence of tiles, checking after each change
+            unsigned state = 12345u;
+            for (int change = 0; change < 40; ++change) {
+                state = state * 1103515245u + 12345u;
+                const int x = static_cast<int>((state >> 8) % mapSize);
+                const int y = static_cast<int>((state >> 20) % mapSize);
+                walkable[y * mapSize + x] = !walkable[y * mapSize + x];
+
+                updateCorridorGraph(graph, x, y, isWalkable);
+                expectMatchesFloodFill(graph, walkable, goals);
+                if (HasFatalFailure()) {
+                    return;
+                }
+            }
+        }
+    }
+}
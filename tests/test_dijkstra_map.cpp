@@ -130,6 +130,16 @@ TEST_F(DijkstraMapTest, CalculateManhattanDistance) {
     EXPECT_EQ(map.calculateDistance(5, 5, 2, 3), 5);  // |5-2| + |5-3| = 5
 }
 
+TEST_F(DijkstraMapTest, CalculateOctileDistance) {
+    DijkstraMap map(testWidth, testHeight, DistanceType::Octile);
+
+    EXPECT_EQ(map.calculateDistance(0, 0, 1, 0), 1000);  // Horizontal
+    EXPECT_EQ(map.calculateDistance(0, 0, 0, -1), 1000); // Vertical
+    EXPECT_EQ(map.calculateDistance(0, 0, 1, 1), 1414);  // Diagonal
+    EXPECT_EQ(map.calculateDistance(0, 0, 3, 4), 5242);  // 3 diagonal + 1 straight
+    EXPECT_EQ(map.calculateDistance(5, 5, 2, 5), 3000);  // 3 straight
+}
+
 TEST_F(DijkstraMapTest, CalculateChebyshevDistance) {
     DijkstraMap map(testWidth, testHeight, DistanceType::Chebyshev);
 
@@ -179,6 +189,18 @@ TEST_F(DijkstraMapTest, GetDimensionsReturnsCorrectValues) {
     EXPECT_EQ(height, 25);
 }
 
+TEST_F(DijkstraMapTest, GetRowIsRowMajor) {
+    DijkstraMap map(4, 3);
+    map.setDistance(2, 1, 7);
+
+    const int* row = map.getRow(1);
+    EXPECT_EQ(row[2], 7);
+    EXPECT_EQ(row[1], DijkstraMap::UNREACHABLE);
+
+    map.getRow(2)[3] = 5;
+    EXPECT_EQ(map.getDistance(3, 2), 5);
+}
+
 // Edge cases
 TEST_F(DijkstraMapTest, SingleTileMap) {
     DijkstraMap map(1, 1);
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for distance matrix tests
+class DistanceMatrixTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 40;
+
+    // Vertical wall at x=20 splits the map into two rooms
+    static bool walkableWithWall(int x, int) {
+        return x != 20;
+    }
+};
+
+TEST_F(DistanceMatrixTest, MatchesDijkstraMaps) {
+    const CoordList sources = {{5, 5}, {33, 20}, {50, 50}, {1, 38}, {20, 20}};
+    const CoordList targets = {{3, 7}, {36, 36}, {12, 30}, {3, 7}, {39, 0}, {18, 2}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        for (int threadCount : {1, 3}) {
+            DistanceMatrix matrix = distanceMatrix(mapSize, mapSize, sources, targets, scatteredWalls,
+                                                   distType, threadCount);
+            ASSERT_EQ(matrix.getDimensions(), std::make_tuple(5, 6));
+
+            for (int source = 0; source < 5; ++source) {
+                DijkstraMap map(mapSize, mapSize, distType);
+                generateDijkstraMap(map, {sources[source]}, scatteredWalls);
+
+                for (int target = 0; target < 6; ++target) {
+                    const auto [targetX, targetY] = targets[target];
+                    EXPECT_EQ(matrix.getDistance(source, target), map.getDistance(targetX, targetY))
+                        << "source " << source << " target " << target;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(DistanceMatrixTest, UnconnectedPairsAreUnreachable) {
+    const CoordList sources = {{2, 2}, {20, 5}, {-1, 0}};
+    const CoordList targets = {{5, 5}, {30, 30}, {20, 9}, {2, 2}};
+
+    DistanceMatrix matrix = distanceMatrix(mapSize, mapSize, sources, targets, walkableWithWall,
+                                           DistanceType::Manhattan);
+
+    EXPECT_EQ(matrix.getDistance(0, 0), 6);
+    EXPECT_EQ(matrix.getDistance(0, 1), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(matrix.getDistance(0, 2), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(matrix.getDistance(0, 3), 0);
+    for (int target = 0; target < 4; ++target) {
+        EXPECT_EQ(matrix.getDistance(1, target), DijkstraMap::UNREACHABLE);
+        EXPECT_EQ(matrix.getDistance(2, target), DijkstraMap::UNREACHABLE);
+    }
+}
+
+TEST_F(DistanceMatrixTest, EmptyListsAndOutOfRangeIndices) {
+    DistanceMatrix noTargets = distanceMatrix(mapSize, mapSize, {{1, 1}}, {}, walkableWithWall);
+    EXPECT_EQ(noTargets.getDimensions(), std::make_tuple(1, 0));
+
+    DistanceMatrix noSources = distanceMatrix(mapSize, mapSize, {}, {{1, 1}}, walkableWithWall);
+    EXPECT_EQ(noSources.getDimensions(), std::make_tuple(0, 1));
+
+    DistanceMatrix matrix(2, 3);
+    matrix.setDistance(1, 2, 7);
+    matrix.setDistance(2, 0, 9);
+    EXPECT_EQ(matrix.getDistance(1, 2), 7);
+    EXPECT_EQ(matrix.getRow(1)[2], 7);
+    EXPECT_EQ(matrix.getDistance(2, 0), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(matrix.getDistance(0, -1), DijkstraMap::UNREACHABLE);
+}
@@ -69,6 +69,39 @@ TEST_F(DistanceTypeTest, EuclideanDistanceProperties) {
     EXPECT_EQ(map.getDistance(11, 11), 2);
 }
 
+// Test Octile distance properties
+TEST_F(DistanceTypeTest, OctileDistanceProperties) {
+    DijkstraMap map(mapWidth, mapHeight, DistanceType::Octile);
+    CoordList goals = {{10, 10}};
+
+    generateDijkstraMap(map, goals, allWalkable);
+
+    // Orthogonal and diagonal steps have different fixed-point costs
+    EXPECT_EQ(map.getDistance(11, 10), DijkstraMap::OCTILE_ORTHOGONAL_COST);
+    EXPECT_EQ(map.getDistance(11, 11), DijkstraMap::OCTILE_DIAGONAL_COST);
+
+    // From (10, 10) to (13, 14): 3 diagonal steps + 1 straight step
+    EXPECT_EQ(map.getDistance(13, 14), 3 * 1414 + 1000);
+
+    // A diagonal step is cheaper than two straight steps but dearer than one
+    EXPECT_LT(map.getDistance(11, 11), map.getDistance(12, 10));
+    EXPECT_GT(map.getDistance(11, 11), map.getDistance(11, 10));
+}
+
+// On an open map every tile's octile path cost equals the closed-form octile distance
+TEST_F(DistanceTypeTest, OctileGenerationMatchesCalculateDistance) {
+    DijkstraMap map(mapWidth, mapHeight, DistanceType::Octile);
+    CoordList goals = {{3, 15}};
+
+    generateDijkstraMap(map, goals, allWalkable);
+
+    for (int x = 0; x < mapWidth; ++x) {
+        for (int y = 0; y < mapHeight; ++y) {
+            EXPECT_EQ(map.getDistance(x, y), map.calculateDistance(3, 15, x, y));
+        }
+    }
+}
+
 // Compare all three distance types from same starting point
 TEST_F(DistanceTypeTest, CompareAllDistanceTypesAtPoint) {
     const int startX = 10, startY = 10;
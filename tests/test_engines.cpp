@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for alternative generation engines
+class GenerationEngineTest : public ::testing::Test {
+protected:
+    // Rounded straight-line distance to the closest goal
+    static int nearestGoalDistance(int x, int y, const CoordList& goals) {
+        double best = 1e30;
+        for (const auto& [goalX, goalY] : goals) {
+            best = std::min(best, std::hypot(x - goalX, y - goalY));
+        }
+        return static_cast<int>(std::round(best));
+    }
+
+    // Conservative line of sight: samples along the segment, each blocked by any wall within a sample spacing
+    template<typename WalkableFunc>
+    static bool clearLine(int x0, int y0, int x1, int y1, WalkableFunc isWalkable) {
+        constexpr int samplesPerTile = 16;
+        constexpr double margin = 1.0 / samplesPerTile;
+        const int samples = samplesPerTile * (std::abs(x1 - x0) + std::abs(y1 - y0)) + 1;
+        for (int sample = 0; sample <= samples; ++sample) {
+            const double t = static_cast<double>(sample) / samples;
+            const double x = x0 + (x1 - x0) * t + 0.5;
+            const double y = y0 + (y1 - y0) * t + 0.5;
+            for (const double offsetX : {-margin, margin}) {
+                for (const double offsetY : {-margin, margin}) {
+                    if (!isWalkable(static_cast<int>(std::floor(x + offsetX)), static_cast<int>(std::floor(y + offsetY)))) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(GenerationEngineTest, EuclideanTransformIsExactOnOpenMap) {
+    constexpr int width = 37;
+    constexpr int height = 23;
+    CoordList goals = {{3, 4}, {30, 18}, {20, 0}};
+
+    DijkstraMap map(width, height, DistanceType::Euclidean);
+    generateDijkstraMap(map, goals, allWalkable, GenerationEngine::EuclideanTransform);
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            ASSERT_EQ(map.getDistance(x, y), nearestGoalDistance(x, y, goals)) << "at " << x << "," << y;
+        }
+    }
+}
+
+TEST_F(GenerationEngineTest, EuclideanTransformWithoutGoalsLeavesMapUnreachable) {
+    DijkstraMap map(8, 8, DistanceType::Euclidean);
+    generateDijkstraMap(map, {{-1, 3}}, allWalkable, GenerationEngine::EuclideanTransform);
+
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            EXPECT_FALSE(map.isReachable(x, y));
+        }
+    }
+}
+
+TEST_F(GenerationEngineTest, EuclideanTransformMeasuresStraightLinesBesideWalls) {
+    // Vertical wall at x=5 with no gap
+    auto walkableWithWall = [](int x, int) {
+        return x != 5;
+    };
+
+    DijkstraMap map(10, 10, DistanceType::Euclidean);
+    generateDijkstraMap(map, {{0, 0}}, walkableWithWall, GenerationEngine::EuclideanTransform);
+
+    // The wall does not block these lines, so they stay straight
+    EXPECT_EQ(map.getDistance(0, 0), 0);
+    EXPECT_EQ(map.getDistance(3, 4), 5);
+    EXPECT_EQ(map.getDistance(4, 9), 10);
+    EXPECT_FALSE(map.isReachable(5, 0));
+    EXPECT_FALSE(map.isReachable(6, 0));
+}
+
+TEST_F(GenerationEngineTest, EuclideanTransformBendsAroundWallCorners) {
+    // Wall from (3,0) down to (3,5); paths to the right side go around its end
+    auto walkableWithWall = [](int x, int y) {
+        return x != 3 || y > 5;
+    };
+
+    DijkstraMap map(8, 8, DistanceType::Euclidean);
+    generateDijkstraMap(map, {{1, 0}}, walkableWithWall, GenerationEngine::EuclideanTransform);
+
+    // Bends at (2,6) and (4,6), the tiles beside the end of the wall: 2 * sqrt(37) + 2
+    EXPECT_EQ(map.getDistance(5, 0), 14);
+    EXPECT_EQ(map.getDistance(4, 6), 8);
+    EXPECT_EQ(map.getDistance(1, 7), 7);
+}
+
+TEST_F(GenerationEngineTest, EuclideanTransformWithWallsStaysWithinPathBounds) {
+    constexpr int size = 48;
+    const auto [goalX, goalY] = Coord{20, 20};
+    ASSERT_TRUE(scatteredWalls(goalX, goalY));
+
+    DijkstraMap floodFill(size, size, DistanceType::Euclidean);
+    DijkstraMap transform(size, size, DistanceType::Euclidean);
+    generateDijkstraMap(floodFill, {{goalX, goalY}}, scatteredWalls);
+    generateDijkstraMap(transform, {{goalX, goalY}}, scatteredWalls, GenerationEngine::EuclideanTransform);
+
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            ASSERT_EQ(transform.isReachable(x, y), floodFill.isReachable(x, y)) << "at " << x << "," << y;
+            if (!transform.isReachable(x, y)) {
+                continue;
+            }
+            // Never shorter than the straight line, never longer than the 4-directional path
+            const int straight = nearestGoalDistance(x, y, {{goalX, goalY}});
+            EXPECT_GE(transform.getDistance(x, y), straight) << "at " << x << "," << y;
+            EXPECT_LE(transform.getDistance(x, y), floodFill.getDistance(x, y)) << "at " << x << "," << y;
+            if (clearLine(goalX, goalY, x, y, scatteredWalls)) {
+                EXPECT_EQ(transform.getDistance(x, y), straight) << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(GenerationEngineTest, NonEuclideanMapsFallBackToFloodFill) {
+    constexpr int size = 32;
+    CoordList goals = {{2, 2}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap expected(size, size, distType);
+        DijkstraMap actual(size, size, distType);
+        generateDijkstraMap(expected, goals, scatteredWalls);
+        generateDijkstraMap(actual, goals, scatteredWalls, GenerationEngine::EuclideanTransform);
+
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y));
+            }
+        }
+    }
+}
+
+TEST_F(GenerationEngineTest, ChamferSweepMatchesFloodFill) {
+    constexpr int size = 48;
+    CoordList goals = {{1, 1}, {40, 30}, {-3, 5}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev,
+                                  DistanceType::Euclidean, DistanceType::Octile}) {
+        DijkstraMap expected(size, size, distType);
+        DijkstraMap actual(size, size, distType);
+        generateDijkstraMap(expected, goals, scatteredWalls);
+        generateDijkstraMap(actual, goals, scatteredWalls, GenerationEngine::ChamferSweep);
+
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(GenerationEngineTest, ChamferSweepFollowsWindingCorridor) {
+    // Serpentine: horizontal walls with gaps alternating between the two ends
+    auto serpentine = [](int x, int y) {
+        if (y % 2 == 0) {
+            return true;
+        }
+        return ((y / 2) % 2 == 0) ? x == 9 : x == 0;
+    };
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Octile}) {
+        DijkstraMap expected(10, 12, distType);
+        DijkstraMap actual(10, 12, distType);
+        generateDijkstraMap(expected, {{0, 0}}, serpentine);
+        generateDijkstraMap(actual, {{0, 0}}, serpentine, GenerationEngine::ChamferSweep);
+
+        for (int y = 0; y < 12; ++y) {
+            for (int x = 0; x < 10; ++x) {
+                ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(GenerationEngineTest, ChamferSweepHandlesSingleColumnMap) {
+    DijkstraMap map(1, 5, DistanceType::Chebyshev);
+    generateDijkstraMap(map, {{0, 2}}, allWalkable, GenerationEngine::ChamferSweep);
+
+    EXPECT_EQ(map.getDistance(0, 0), 2);
+    EXPECT_EQ(map.getDistance(0, 2), 0);
+    EXPECT_EQ(map.getDistance(0, 4), 2);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for farthest-tile and histogram tests
+class FarthestTilesTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 40;
+
+    // All reachable tiles, farthest first, ties in scan order
+    static CoordList sortByDistance(const DijkstraMap& map) {
+        CoordList tiles;
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                if (map.isReachable(x, y)) {
+                    tiles.emplace_back(x, y);
+                }
+            }
+        }
+        std::stable_sort(tiles.begin(), tiles.end(), [&map](const Coord& a, const Coord& b) {
+            const auto [ax, ay] = a;
+            const auto [bx, by] = b;
+            return map.getDistance(ax, ay) > map.getDistance(bx, by);
+        });
+        return tiles;
+    }
+};
+
+TEST_F(FarthestTilesTest, MatchesSortedScan) {
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Octile}) {
+        DijkstraMap map(mapSize, mapSize, distType);
+        generateDijkstraMap(map, {{5, 5}, {33, 20}}, scatteredWalls);
+        const CoordList expected = sortByDistance(map);
+
+        for (int count : {1, 5, 50, static_cast<int>(expected.size()), 5000}) {
+            const CoordList farthest = findFarthestTiles(map, count);
+            const std::size_t expectedCount = std::min(expected.size(), static_cast<std::size_t>(count));
+            ASSERT_EQ(farthest.size(), expectedCount);
+            EXPECT_TRUE(std::equal(farthest.begin(), farthest.end(), expected.begin())) << "count " << count;
+        }
+    }
+}
+
+TEST_F(FarthestTilesTest, SettleOrderGivesFarthestDistances) {
+    DijkstraMap map(mapSize, mapSize, DistanceType::Octile);
+    SettleOrder settleOrder(mapSize, mapSize);
+    generateDijkstraMap(map, {{20, 21}}, scatteredWalls, settleOrder);
+    const CoordList expected = sortByDistance(map);
+
+    // Ties may come out in another order, but the distances agree
+    const CoordList farthest = findFarthestTiles(settleOrder, 30);
+    ASSERT_EQ(farthest.size(), 30u);
+    for (std::size_t i = 0; i < farthest.size(); ++i) {
+        const auto [x, y] = farthest[i];
+        const auto [expectedX, expectedY] = expected[i];
+        EXPECT_EQ(map.getDistance(x, y), map.getDistance(expectedX, expectedY));
+    }
+
+    EXPECT_EQ(findFarthestTiles(settleOrder, 100000).size(), expected.size());
+    EXPECT_TRUE(findFarthestTiles(settleOrder, 0).empty());
+}
+
+TEST_F(FarthestTilesTest, HistogramCountsReachableTiles) {
+    for (const auto& [distType, bucketWidth] : std::vector<std::tuple<DistanceType, int>>{
+             {DistanceType::Manhattan, 5}, {DistanceType::Manhattan, 1}, {DistanceType::Octile, 1414}}) {
+        DijkstraMap map(mapSize, mapSize, distType);
+        generateDijkstraMap(map, {{3, 7}}, scatteredWalls);
+
+        std::vector<int> expected;
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                if (map.isReachable(x, y)) {
+                    const std::size_t bucket = map.getDistance(x, y) / bucketWidth;
+                    expected.resize(std::max(expected.size(), bucket + 1), 0);
+                    ++expected[bucket];
+                }
+            }
+        }
+
+        EXPECT_EQ(computeDistanceHistogram(map, bucketWidth), expected) << "bucket width " << bucketWidth;
+        EXPECT_TRUE(computeDistanceHistogram(map, 0).empty());
+    }
+}
+
+TEST_F(FarthestTilesTest, UnreachableMap) {
+    DijkstraMap map(mapSize, mapSize);
+
+    EXPECT_TRUE(findFarthestTiles(map, 3).empty());
+    EXPECT_TRUE(findFarthestTiles(map, 0).empty());
+    EXPECT_TRUE(computeDistanceHistogram(map, 10).empty());
+
+    map.setDistance(7, 2, 12);
+    EXPECT_EQ(findFarthestTiles(map, 3), CoordList({{7, 2}}));
+    EXPECT_EQ(computeDistanceHistogram(map, 10), std::vector<int>({0, 1}));
+}
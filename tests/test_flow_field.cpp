@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for flow field tests
+class FlowFieldTest : public ::testing::Test {
+protected:
+    // Wider than the row kernel's blocks, with a partial last block
+    static constexpr int mapWidth = 83;
+    static constexpr int mapHeight = 41;
+
+    static int stepCost(DistanceType distType, int dx, int dy) {
+        if (distType != DistanceType::Octile) {
+            return 1;
+        }
+        return (dx != 0 && dy != 0) ? 1414 : 1000;
+    }
+
+    // Lowest direction index of a neighbor with minimal distance plus step cost,
+    // read through bounds-checked getDistance
+    static int referenceDirection(const DijkstraMap& map, int x, int y) {
+        static const int stepX[] = {0, 0, 1, -1, 1, 1, -1, -1};
+        static const int stepY[] = {1, -1, 0, 0, 1, -1, 1, -1};
+        const bool diagonal = map.getDistanceType() == DistanceType::Chebyshev
+                              || map.getDistanceType() == DistanceType::Octile;
+        if (!map.isReachable(x, y)) {
+            return FlowField::NO_DIRECTION;
+        }
+
+        long long best = DijkstraMap::UNREACHABLE;
+        int bestDirection = FlowField::NO_DIRECTION;
+        for (int direction = 0; direction < (diagonal ? 8 : 4); ++direction) {
+            const int neighbor = map.getDistance(x + stepX[direction], y + stepY[direction]);
+            if (neighbor == DijkstraMap::UNREACHABLE) {
+                continue;
+            }
+            const long long candidate = static_cast<long long>(neighbor)
+                                        + stepCost(map.getDistanceType(), stepX[direction], stepY[direction]);
+            if (candidate < best) {
+                best = candidate;
+                bestDirection = direction;
+            }
+        }
+        return (best <= map.getDistance(x, y)) ? bestDirection : FlowField::NO_DIRECTION;
+    }
+};
+
+TEST_F(FlowFieldTest, MatchesNeighborScan) {
+    const CoordList goals = {{4, 4}, {70, 30}};
+
+    for (int width : {mapWidth, 20}) {
+        for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev,
+                                      DistanceType::Euclidean, DistanceType::Octile}) {
+            DijkstraMap map(width, mapHeight, distType);
+            generateDijkstraMap(map, goals, scatteredWalls);
+
+            for (int threadCount : {1, 3}) {
+                const FlowField field = generateFlowField(map, threadCount);
+                EXPECT_EQ(field.getDimensions(), map.getDimensions());
+                EXPECT_EQ(field.getDistanceType(), distType);
+                for (int y = 0; y < mapHeight; ++y) {
+                    for (int x = 0; x < width; ++x) {
+                        ASSERT_EQ(field.getDirection(x, y), referenceDirection(map, x, y))
+                            << "at " << x << "," << y << " width " << width;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(FlowFieldTest, FollowingStepsReachGoal) {
+    const CoordList goals = {{4, 4}, {70, 30}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Octile}) {
+        DijkstraMap map(mapWidth, mapHeight, distType);
+        generateDijkstraMap(map, goals, scatteredWalls);
+        const FlowField field = generateFlowField(map);
+
+        for (int y = 0; y < mapHeight; ++y) {
+            for (int x = 0; x < mapWidth; ++x) {
+                if (!map.isReachable(x, y)) {
+                    EXPECT_EQ(field.getStep(x, y), std::make_tuple(0, 0));
+                    continue;
+                }
+
+                // Every step descends by exactly its cost, down to distance 0
+                int currentX = x;
+                int currentY = y;
+                while (map.getDistance(currentX, currentY) > 0) {
+                    const auto [dx, dy] = field.getStep(currentX, currentY);
+                    ASSERT_TRUE(dx != 0 || dy != 0) << "stuck at " << currentX << "," << currentY;
+                    ASSERT_TRUE(scatteredWalls(currentX + dx, currentY + dy));
+                    ASSERT_EQ(map.getDistance(currentX + dx, currentY + dy),
+                              map.getDistance(currentX, currentY) - stepCost(distType, dx, dy));
+                    currentX += dx;
+                    currentY += dy;
+                }
+                EXPECT_EQ(field.getDirection(currentX, currentY), FlowField::NO_DIRECTION);
+            }
+        }
+    }
+}
+
+TEST_F(FlowFieldTest, SamePassMatchesSeparatePass) {
+    const CoordList goals = {{4, 4}, {70, 30}, {40, 2}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap expectedMap(mapWidth, mapHeight, distType);
+        generateDijkstraMap(expectedMap, goals, scatteredWalls);
+        const FlowField expected = generateFlowField(expectedMap);
+
+        DijkstraMap map(mapWidth, mapHeight, distType);
+        FlowField field(mapWidth, mapHeight);
+        generateDijkstraMap(map, goals, scatteredWalls, field);
+
+        EXPECT_EQ(field.getDistanceType(), distType);
+        for (int y = 0; y < mapHeight; ++y) {
+            for (int x = 0; x < mapWidth; ++x) {
+                ASSERT_EQ(map.getDistance(x, y), expectedMap.getDistance(x, y)) << "at " << x << "," << y;
+                ASSERT_EQ(field.getDirection(x, y), expected.getDirection(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(FlowFieldTest, StorageAndBounds) {
+    FlowField field(3, 2, DistanceType::Chebyshev);
+    EXPECT_EQ(field.getDirection(1, 1), FlowField::NO_DIRECTION);
+
+    field.setDirection(1, 1, 5);
+    EXPECT_EQ(field.getDirection(1, 1), 5);
+    EXPECT_EQ(field.getStep(1, 1), std::make_tuple(1, -1));
+    EXPECT_EQ(field.getRow(1)[1], 5);
+
+    field.setDirection(5, 5, 2);
+    EXPECT_EQ(field.getDirection(5, 5), FlowField::NO_DIRECTION);
+    EXPECT_EQ(field.getDirection(-1, 0), FlowField::NO_DIRECTION);
+
+    field.clear();
+    EXPECT_EQ(field.getDirection(1, 1), FlowField::NO_DIRECTION);
+    EXPECT_EQ(field.getRow(1)[1], FlowField::NO_DIRECTION_BYTE);
+}
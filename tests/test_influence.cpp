@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for influence map tests
+class InfluenceMapTest : public ::testing::Test {
+protected:
+    static constexpr int mapWidth = 60;
+    static constexpr int mapHeight = 45;
+
+    static std::vector<InfluenceSource> walkableSources() {
+        std::vector<InfluenceSource> sources;
+        for (int i = 0; i < 12; ++i) {
+            const int x = (i * 17 + 3) % mapWidth;
+            const int y = (i * 11 + 5) % mapHeight;
+            if (scatteredWalls(x, y)) {
+                sources.push_back({x, y, (i % 3 == 0) ? -2.0 : 1.5});
+            }
+        }
+        return sources;
+    }
+
+    // One full Dijkstra map per source, then a sum of rounded fixed-point falloffs
+    static std::vector<int> referenceInfluence(const std::vector<InfluenceSource>& sources,
+                                               const InfluenceFalloff& falloff,
+                                               DistanceType distType) {
+        std::vector<int> influence(static_cast<std::size_t>(mapWidth) * mapHeight, 0);
+        for (const InfluenceSource& source : sources) {
+            DijkstraMap map(mapWidth, mapHeight, distType);
+            generateDijkstraMap(map, {{source.x, source.y}}, scatteredWalls);
+            for (int y = 0; y < mapHeight; ++y) {
+                for (int x = 0; x < mapWidth; ++x) {
+                    const int distance = map.getDistance(x, y);
+                    if (!map.isReachable(x, y) || distance > falloff.cutoff) {
+                        continue;
+                    }
+                    const double decay = (falloff.type == FalloffType::Exponential)
+                                             ? std::exp2(-distance / falloff.halfLife)
+                                             : 1.0 - static_cast<double>(distance) / falloff.cutoff;
+                    influence[static_cast<std::size_t>(y) * mapWidth + x] +=
+                        static_cast<int>(std::lround(source.strength * decay * InfluenceMap::FIXED_POINT_SCALE));
+                }
+            }
+        }
+        return influence;
+    }
+};
+
+TEST_F(InfluenceMapTest, MatchesPerSourceDijkstraMaps) {
+    const std::vector<InfluenceSource> sources = walkableSources();
+    ASSERT_GE(sources.size(), 4u);
+
+    const InfluenceFalloff exponential{FalloffType::Exponential, 12000, 3000.0};
+    const InfluenceFalloff linear{FalloffType::Linear, 9, 0.0};
+    for (const auto& [distType, falloff] : {std::make_tuple(DistanceType::Octile, exponential),
+                                            std::make_tuple(DistanceType::Manhattan, linear),
+                                            std::make_tuple(DistanceType::Chebyshev, InfluenceFalloff{})}) {
+        InfluenceMap influenceMap(mapWidth, mapHeight, distType);
+        generateInfluenceMap(influenceMap, sources, scatteredWalls, falloff);
+
+        const std::vector<int> expected = referenceInfluence(sources, falloff, distType);
+        for (int y = 0; y < mapHeight; ++y) {
+            for (int x = 0; x < mapWidth; ++x) {
+                ASSERT_EQ(influenceMap.getRawInfluence(x, y), expected[static_cast<std::size_t>(y) * mapWidth + x])
+                    << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(InfluenceMapTest, ThreadCountDoesNotChangeResult) {
+    const std::vector<InfluenceSource> sources = walkableSources();
+    const InfluenceFalloff falloff{FalloffType::Exponential, 20000, 4000.0};
+
+    InfluenceMap singleThread(mapWidth, mapHeight, DistanceType::Octile);
+    generateInfluenceMap(singleThread, sources, scatteredWalls, falloff, 1);
+
+    for (int threadCount : {2, 5, 64}) {
+        InfluenceMap threaded(mapWidth, mapHeight, DistanceType::Octile);
+        generateInfluenceMap(threaded, sources, scatteredWalls, falloff, threadCount);
+        for (int y = 0; y < mapHeight; ++y) {
+            for (int x = 0; x < mapWidth; ++x) {
+                ASSERT_EQ(threaded.getRawInfluence(x, y), singleThread.getRawInfluence(x, y))
+                    << "at " << x << "," << y << " with " << threadCount << " threads";
+            }
+        }
+    }
+}
+
+TEST_F(InfluenceMapTest, CutoffWallsAndSaturation) {
+    const InfluenceFalloff linear{FalloffType::Linear, 4, 0.0};
+
+    // Linear falloff: full strength on the source, 0 from the cutoff on
+    InfluenceMap influenceMap(20, 20, DistanceType::Manhattan);
+    generateInfluenceMap(influenceMap, {{10, 10, 2.0}}, allWalkable, linear);
+    EXPECT_FLOAT_EQ(influenceMap.getInfluence(10, 10), 2.0f);
+    EXPECT_FLOAT_EQ(influenceMap.getInfluence(12, 10), 1.0f);
+    EXPECT_FLOAT_EQ(influenceMap.getInfluence(11, 12), 0.5f);
+    EXPECT_EQ(influenceMap.getRawInfluence(14, 10), 0);
+    EXPECT_EQ(influenceMap.getRawInfluence(15, 10), 0);
+
+    // Sources on walls or out of bounds add nothing
+    generateInfluenceMap(influenceMap, {{-1, 3, 5.0}, {3, 3, 5.0}}, [](int x, int y) { return x != 3 || y != 3; });
+    for (int y = 0; y < 20; ++y) {
+        for (int x = 0; x < 20; ++x) {
+            ASSERT_EQ(influenceMap.getRawInfluence(x, y), 0) << "at " << x << "," << y;
+        }
+    }
+
+    // Opposing sources cancel, and totals saturate instead of wrapping
+    generateInfluenceMap(influenceMap, {{5, 5, 1.5}, {5, 5, -1.5}, {15, 15, 2e6}, {15, 15, 2e6}}, allWalkable, linear);
+    EXPECT_EQ(influenceMap.getRawInfluence(5, 5), 0);
+    EXPECT_EQ(influenceMap.getRawInfluence(15, 15), std::numeric_limits<int>::max());
+}
+
+TEST_F(InfluenceMapTest, NonPositiveHalfLifeKeepsInfluenceOnTheSource) {
+
+    for (double halfLife : {0.0, -2.0, std::nan("")}) {
+        InfluenceMap influenceMap(9, 9, DistanceType::Chebyshev);
+        generateInfluenceMap(influenceMap, {{4, 4, 1.5}, {6, 4, -0.5}}, allWalkable, {FalloffType::Exponential, 5, halfLife});
+
+        for (int y = 0; y < 9; ++y) {
+            for (int x = 0; x < 9; ++x) {
+                const int expected = (x == 4 && y == 4) ? 1536 : (x == 6 && y == 4) ? -512 : 0;
+                ASSERT_EQ(influenceMap.getRawInfluence(x, y), expected) << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(InfluenceMapTest, NegativeAndHugeCutoffs) {
+    InfluenceMap influenceMap(12, 12, DistanceType::Octile);
+
+    // A negative cutoff reaches nothing, not even the source
+    generateInfluenceMap(influenceMap, {{6, 6, 1.0}}, allWalkable, {FalloffType::Linear, -1, 0.0});
+    for (int y = 0; y < 12; ++y) {
+        for (int x = 0; x < 12; ++x) {
+            ASSERT_EQ(influenceMap.getRawInfluence(x, y), 0) << "at " << x << "," << y;
+        }
+    }
+
+    // A cutoff at the top of the int range reaches the whole map without overflowing
+    const InfluenceFalloff unbounded{FalloffType::Exponential, std::numeric_limits<int>::max(), 1e9};
+    generateInfluenceMap(influenceMap, {{6, 6, 1.0}}, allWalkable, unbounded);
+    for (int y = 0; y < 12; ++y) {
+        for (int x = 0; x < 12; ++x) {
+            ASSERT_GT(influenceMap.getRawInfluence(x, y), 0) << "at " << x << "," << y;
+        }
+    }
+}
+
+TEST_F(InfluenceMapTest, StorageAndBounds) {
+    InfluenceMap influenceMap(3, 2, DistanceType::Octile);
+    EXPECT_EQ(influenceMap.getDimensions(), std::make_tuple(3, 2));
+    EXPECT_EQ(influenceMap.getDistanceType(), DistanceType::Octile);
+
+    influenceMap.setRawInfluence(2, 1, InfluenceMap::FIXED_POINT_SCALE * 3 / 4);
+    EXPECT_FLOAT_EQ(influenceMap.getInfluence(2, 1), 0.75f);
+    EXPECT_EQ(influenceMap.getRow(1)[2], InfluenceMap::FIXED_POINT_SCALE * 3 / 4);
+
+    influenceMap.setRawInfluence(3, 1, 7);
+    EXPECT_EQ(influenceMap.getRawInfluence(3, 1), 0);
+    EXPECT_FLOAT_EQ(influenceMap.getInfluence(-1, 0), 0.0f);
+
+    influenceMap.clear();
+    EXPECT_EQ(influenceMap.getRawInfluence(2, 1), 0);
+}
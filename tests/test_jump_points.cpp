@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for jump point search tests
+class JumpPointSearchTest : public ::testing::Test {
+protected:
+    // Wider than one 64-bit word so scans cross word boundaries
+    static constexpr int mapWidth = 150;
+    static constexpr int mapHeight = 90;
+
+    // Grid of rooms joined by one-tile doors
+    static bool rooms(int x, int y) {
+        return !((x % 17 == 0 && y % 11 != 5) || (y % 13 == 0 && x % 7 != 3));
+    }
+};
+
+TEST_F(JumpPointSearchTest, GridMirrorsWalkability) {
+    JumpPointGrid grid = buildJumpPointGrid(mapWidth, mapHeight, scatteredWalls, DistanceType::Octile);
+
+    EXPECT_EQ(grid.isWalkable(50, 50), scatteredWalls(50, 50));
+    EXPECT_EQ(grid.isWalkable(0, 0), scatteredWalls(0, 0));
+    EXPECT_FALSE(grid.isWalkable(-1, 0));
+    EXPECT_EQ(grid.getColumns().get(50, 50), grid.getRows().get(50, 50));
+
+    grid.setWalkable(0, 0, true);
+    EXPECT_TRUE(grid.isWalkable(0, 0));
+    EXPECT_TRUE(grid.getColumns().get(0, 0));
+}
+
+TEST_F(JumpPointSearchTest, OpenMapNeedsFewExpansions) {
+    JumpPointGrid grid = buildJumpPointGrid(mapWidth, mapHeight, allWalkable, DistanceType::Octile);
+    SearchWorkspace workspace(mapWidth, mapHeight);
+
+    // 80 diagonal steps, then 69 straight ones
+    EXPECT_EQ(queryDistance(workspace, grid, {0, 0}, {149, 80}), 80 * 1414 + 69 * 1000);
+    EXPECT_LE(workspace.getExpansionCount(), 4);
+}
+
+TEST_F(JumpPointSearchTest, MatchesDijkstraMap) {
+    SearchWorkspace workspace(mapWidth, mapHeight);
+    const CoordList starts = {{3, 7}, {10, 40}, {149, 2}, {70, 89}, {130, 45}, {64, 64}};
+
+    for (auto isWalkable : {scatteredWalls, rooms}) {
+        for (DistanceType distType : {DistanceType::Chebyshev, DistanceType::Octile}) {
+            JumpPointGrid grid = buildJumpPointGrid(mapWidth, mapHeight, isWalkable, distType);
+            for (const Coord& goal : CoordList{{50, 50}, {120, 20}}) {
+                DijkstraMap map(mapWidth, mapHeight, distType);
+                generateDijkstraMap(map, {goal}, isWalkable);
+
+                for (const auto& [startX, startY] : starts) {
+                    EXPECT_EQ(queryDistance(workspace, grid, {startX, startY}, goal), map.getDistance(startX, startY));
+                }
+            }
+        }
+    }
+}
+
+TEST_F(JumpPointSearchTest, PathVisitsEveryTile) {
+    JumpPointGrid grid = buildJumpPointGrid(mapWidth, mapHeight, rooms, DistanceType::Octile);
+    SearchWorkspace workspace(mapWidth, mapHeight);
+
+    CoordList path = findPath(workspace, grid, {3, 7}, {120, 20});
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(path.front(), Coord(3, 7));
+    EXPECT_EQ(path.back(), Coord(120, 20));
+
+    int length = 0;
+    for (std::size_t i = 1; i < path.size(); ++i) {
+        const auto [x, y] = path[i];
+        const auto [previousX, previousY] = path[i - 1];
+        EXPECT_TRUE(rooms(x, y));
+        EXPECT_EQ(std::max(std::abs(x - previousX), std::abs(y - previousY)), 1);
+        length += (x != previousX && y != previousY) ? 1414 : 1000;
+    }
+    EXPECT_EQ(length, queryDistance(workspace, grid, {3, 7}, {120, 20}));
+}
+
+TEST_F(JumpPointSearchTest, FourDirectionalTypesFallBackToAStar) {
+    JumpPointGrid grid = buildJumpPointGrid(mapWidth, mapHeight, scatteredWalls, DistanceType::Manhattan);
+    SearchWorkspace workspace(mapWidth, mapHeight);
+    DijkstraMap map(mapWidth, mapHeight, DistanceType::Manhattan);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    EXPECT_EQ(queryDistance(workspace, grid, {10, 40}, {50, 50}), map.getDistance(10, 40));
+    CoordList path = findPath(workspace, grid, {10, 40}, {50, 50});
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(static_cast<int>(path.size()) - 1, map.getDistance(10, 40));
+}
+
+TEST_F(JumpPointSearchTest, BlockedOrSeparatedEndpoints) {
+    auto walkableWithWall = [](int x, int) {
+        return x != 75;
+    };
+    JumpPointGrid grid = buildJumpPointGrid(mapWidth, mapHeight, walkableWithWall, DistanceType::Chebyshev);
+    SearchWorkspace workspace(mapWidth, mapHeight);
+
+    EXPECT_EQ(queryDistance(workspace, grid, {0, 0}, {149, 89}), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistance(workspace, grid, {0, 0}, {75, 3}), DijkstraMap::UNREACHABLE);
+    EXPECT_EQ(queryDistance(workspace, grid, {4, 4}, {4, 4}), 0);
+    EXPECT_TRUE(findPath(workspace, grid, {0, 0}, {149, 89}).empty());
+}
+
+TEST_F(JumpPointSearchTest, WorkspaceForAnotherMapIsReplaced) {
+    JumpPointGrid grid = buildJumpPointGrid(mapWidth, mapHeight, rooms, DistanceType::Chebyshev);
+    SearchWorkspace sized(mapWidth, mapHeight);
+    SearchWorkspace small(10, 10);
+
+    EXPECT_EQ(findPath(small, grid, {1, 1}, {140, 80}), findPath(sized, grid, {1, 1}, {140, 80}));
+    EXPECT_EQ(small.getDimensions(), std::make_tuple(mapWidth, mapHeight));
+}
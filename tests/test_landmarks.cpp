@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for landmark index tests
+class LandmarkIndexTest : public ::testing::Test {
+protected:
+    static constexpr int mapWidth = 20;
+    static constexpr int mapHeight = 20;
+
+    // Perfect maze of 1-wide corridors carved by a seeded depth-first search
+    static constexpr int mazeSize = 41;
+
+    static bool mazeWalkable(int x, int y) {
+        static const std::vector<bool> walkable = [] {
+            std::vector<bool> carved(mazeSize * mazeSize, false);
+            std::vector<std::tuple<int, int>> stack = {{1, 1}};
+            carved[1 * mazeSize + 1] = true;
+            unsigned seed = 12345u;
+
+            while (!stack.empty()) {
+                const auto [cellX, cellY] = stack.back();
+                std::vector<std::tuple<int, int>> unvisited;
+                for (const auto& [dx, dy] : {std::make_tuple(2, 0), std::make_tuple(-2, 0),
+                                             std::make_tuple(0, 2), std::make_tuple(0, -2)}) {
+                    const int nextX = cellX + dx;
+                    const int nextY = cellY + dy;
+                    if (nextX > 0 && nextX < mazeSize && nextY > 0 && nextY < mazeSize &&
+                        !carved[nextY * mazeSize + nextX]) {
+                        unvisited.emplace_back(nextX, nextY);
+                    }
+                }
+
+                if (unvisited.empty()) {
+                    stack.pop_back();
+                    continue;
+                }
+
+                seed = seed * 1103515245u + 12345u;
+                const auto [nextX, nextY] = unvisited[(seed >> 16) % unvisited.size()];
+                carved[((cellY + nextY) / 2) * mazeSize + (cellX + nextX) / 2] = true;
+                carved[nextY * mazeSize + nextX] = true;
+                stack.emplace_back(nextX, nextY);
+            }
+            return carved;
+        }();
+        return walkable[y * mazeSize + x];
+    }
+};
+
+TEST_F(LandmarkIndexTest, FarthestPointSelectionPicksCorners) {
+    LandmarkIndex index = buildLandmarkIndex(mapWidth, mapHeight, 2, allWalkable, DistanceType::Manhattan);
+
+    ASSERT_EQ(index.getLandmarkCount(), 2);
+    const auto [firstX, firstY] = index.getLandmark(0);
+    const auto [secondX, secondY] = index.getLandmark(1);
+    EXPECT_EQ(std::abs(firstX - secondX) + std::abs(firstY - secondY), 2 * (mapWidth - 1));
+    EXPECT_EQ(index.getDistance(0, firstX, firstY), 0);
+    EXPECT_EQ(index.getScale(0), 1);
+}
+
+TEST_F(LandmarkIndexTest, StopsWhenEveryTileIsALandmark) {
+    auto threeTiles = [](int x, int y) {
+        return y == 0 && x < 3;
+    };
+
+    LandmarkIndex index = buildLandmarkIndex(mapWidth, mapHeight, 8, threeTiles, DistanceType::Manhattan);
+
+    EXPECT_EQ(index.getLandmarkCount(), 3);
+    EXPECT_EQ(buildLandmarkIndex(mapWidth, mapHeight, 8, [](int, int) { return false; }).getLandmarkCount(), 0);
+}
+
+TEST_F(LandmarkIndexTest, ZeroSizedMapHasNoLandmarks) {
+    EXPECT_EQ(buildLandmarkIndex(0, 4, 4, allWalkable).getLandmarkCount(), 0);
+    EXPECT_EQ(buildLandmarkIndex(4, 0, 4, allWalkable).getLandmarkCount(), 0);
+    EXPECT_EQ(buildLandmarkIndex(0, 0, 4, allWalkable).getLandmarkCount(), 0);
+}
+
+TEST_F(LandmarkIndexTest, LowerBoundNeverExceedsTrueDistance) {
+    constexpr int size = 60;
+    LandmarkIndex index = buildLandmarkIndex(size, size, 4, scatteredWalls, DistanceType::Octile);
+    DijkstraMap map(size, size, DistanceType::Octile);
+    generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            if (map.isReachable(x, y)) {
+                EXPECT_LE(index.getLowerBound(x, y, 50, 50), map.getDistance(x, y));
+            }
+        }
+    }
+}
+
+TEST_F(LandmarkIndexTest, ScaledDistancesStayAdmissible) {
+    // Octile distances across this map exceed the 16-bit range
+    constexpr int size = 100;
+    LandmarkIndex index = buildLandmarkIndex(size, size, 2, allWalkable, DistanceType::Octile);
+    ASSERT_GT(index.getScale(0), 1);
+
+    SearchWorkspace workspace(size, size);
+    for (const auto& [startX, startY] : CoordList{{0, 0}, {99, 0}, {37, 81}, {50, 51}}) {
+        const int expected = queryDistance(workspace, {startX, startY}, {50, 50}, allWalkable, DistanceType::Octile);
+        EXPECT_LE(index.getLowerBound(startX, startY, 50, 50), expected);
+        EXPECT_EQ(queryDistance(workspace, index, {startX, startY}, {50, 50}, allWalkable), expected);
+    }
+}
+
+TEST_F(LandmarkIndexTest, QueriesMatchDijkstraMapOnCave) {
+    constexpr int size = 60;
+    SearchWorkspace workspace(size, size);
+    const CoordList starts = {{3, 7}, {10, 40}, {57, 2}, {30, 30}, {49, 51}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        LandmarkIndex index = buildLandmarkIndex(size, size, 4, scatteredWalls, distType);
+        DijkstraMap map(size, size, distType);
+        generateDijkstraMap(map, {{50, 50}}, scatteredWalls);
+
+        for (const auto& [startX, startY] : starts) {
+            EXPECT_EQ(queryDistance(workspace, index, {startX, startY}, {50, 50}, scatteredWalls),
+                      map.getDistance(startX, startY));
+        }
+
+        CoordList path = findPath(workspace, index, {30, 30}, {50, 50}, scatteredWalls);
+        ASSERT_FALSE(path.empty());
+        EXPECT_EQ(path.front(), Coord(30, 30));
+        EXPECT_EQ(path.back(), Coord(50, 50));
+    }
+}
+
+TEST_F(LandmarkIndexTest, CutsExpansionsInMaze) {
+    SearchWorkspace workspace(mazeSize, mazeSize);
+    LandmarkIndex index = buildLandmarkIndex(mazeSize, mazeSize, 4, mazeWalkable, DistanceType::Manhattan);
+    const CoordList endpoints = {{1, 1}, {39, 39}, {1, 39}, {39, 1}, {21, 19}, {7, 33}};
+
+    int plainExpansions = 0;
+    int guidedExpansions = 0;
+    for (const Coord& start : endpoints) {
+        for (const Coord& goal : endpoints) {
+            const int plain = queryDistance(workspace, start, goal, mazeWalkable, DistanceType::Manhattan);
+            plainExpansions += workspace.getExpansionCount();
+            EXPECT_EQ(queryDistance(workspace, index, start, goal, mazeWalkable), plain);
+            guidedExpansions += workspace.getExpansionCount();
+        }
+    }
+
+    EXPECT_LT(guidedExpansions, plainExpansions / 2);
+}
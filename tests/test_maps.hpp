@@ -0,0 +1,14 @@
+#pragma once
+
+// Walkability functions shared by the test suites and benchmarks
+
+// Every tile is walkable
+inline bool allWalkable(int, int) {
+    return true;
+}
+
+// Pseudo-random cave: roughly a third of the tiles are walls
+inline bool scatteredWalls(int x, int y) {
+    const unsigned hash = (static_cast<unsigned>(x) * 73856093u) ^ (static_cast<unsigned>(y) * 19349663u);
+    return (hash % 3) != 0;
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for multi-channel Dijkstra map tests
+class MultiDijkstraMapTest : public ::testing::Test {
+protected:
+    static constexpr int mapWidth = 25;
+    static constexpr int mapHeight = 15;
+};
+
+TEST_F(MultiDijkstraMapTest, ConstructorInitializesAllChannelsUnreachable) {
+    MultiDijkstraMap<3> map(mapWidth, mapHeight, DistanceType::Manhattan);
+    auto [width, height] = map.getDimensions();
+
+    EXPECT_EQ(width, mapWidth);
+    EXPECT_EQ(height, mapHeight);
+    EXPECT_EQ(map.getDistanceType(), DistanceType::Manhattan);
+    for (int channel = 0; channel < 3; ++channel) {
+        EXPECT_FALSE(map.isReachable(channel, 0, 0));
+    }
+}
+
+TEST_F(MultiDijkstraMapTest, ChannelsAreIndependent) {
+    MultiDijkstraMap<2> map(mapWidth, mapHeight);
+
+    map.setDistance(1, 4, 4, 7);
+    EXPECT_EQ(map.getDistance(1, 4, 4), 7);
+    EXPECT_FALSE(map.isReachable(0, 4, 4));
+
+    // Out-of-range channels and tiles are ignored
+    map.setDistance(2, 4, 4, 1);
+    map.setDistance(0, -1, 4, 1);
+    EXPECT_EQ(map.getDistance(2, 4, 4), MultiDijkstraMap<2>::UNREACHABLE);
+    EXPECT_EQ(map.getDistance(0, -1, 4), MultiDijkstraMap<2>::UNREACHABLE);
+
+    map.clear();
+    EXPECT_FALSE(map.isReachable(1, 4, 4));
+}
+
+TEST_F(MultiDijkstraMapTest, ChannelsMatchSeparateGenerations) {
+    std::array<CoordList, 3> goals = {
+        CoordList{{0, 0}},
+        CoordList{{24, 14}, {12, 2}},
+        CoordList{{5, 9}, {20, 3}, {12, 7}}
+    };
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        MultiDijkstraMap<3> multiMap(mapWidth, mapHeight, distType);
+        generateMultiDijkstraMap(multiMap, goals, scatteredWalls);
+
+        for (int channel = 0; channel < 3; ++channel) {
+            DijkstraMap expected(mapWidth, mapHeight, distType);
+            generateDijkstraMap(expected, goals[channel], scatteredWalls);
+            DijkstraMap actual = multiMap.extractChannel(channel);
+
+            for (int y = 0; y < mapHeight; ++y) {
+                for (int x = 0; x < mapWidth; ++x) {
+                    ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y))
+                        << "channel " << channel << " at (" << x << ", " << y << ")";
+                }
+            }
+        }
+    }
+}
+
+TEST_F(MultiDijkstraMapTest, ChannelWithoutGoalsStaysUnreachable) {
+    MultiDijkstraMap<2> map(mapWidth, mapHeight, DistanceType::Manhattan);
+    std::array<CoordList, 2> goals = {CoordList{{3, 3}}, CoordList{}};
+
+    generateMultiDijkstraMap(map, goals, allWalkable);
+
+    EXPECT_EQ(map.getDistance(0, 6, 7), 7);
+    for (int y = 0; y < mapHeight; ++y) {
+        for (int x = 0; x < mapWidth; ++x) {
+            EXPECT_FALSE(map.isReachable(1, x, y));
+        }
+    }
+}
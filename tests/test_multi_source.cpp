@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for per-source map generation tests
+class MultiSourceTest : public ::testing::Test {
+protected:
+    static constexpr int mapWidth = 30;
+    static constexpr int mapHeight = 20;
+
+    static void expectSameDistances(const DijkstraMap& actual, const DijkstraMap& expected) {
+        for (int y = 0; y < mapHeight; ++y) {
+            for (int x = 0; x < mapWidth; ++x) {
+                ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y)) << "at (" << x << ", " << y << ")";
+            }
+        }
+    }
+};
+
+TEST_F(MultiSourceTest, SingleSourceMatchesGenerateDijkstraMap) {
+    auto maps = generatePerSourceDijkstraMaps(mapWidth, mapHeight, {{4, 7}}, allWalkable, DistanceType::Manhattan);
+
+    DijkstraMap expected(mapWidth, mapHeight, DistanceType::Manhattan);
+    generateDijkstraMap(expected, {{4, 7}}, allWalkable);
+
+    ASSERT_EQ(maps.size(), 1u);
+    EXPECT_EQ(maps[0].getDistanceType(), DistanceType::Manhattan);
+    expectSameDistances(maps[0], expected);
+}
+
+TEST_F(MultiSourceTest, MoreThanOneBatchMatchesSeparateGenerations) {
+    // 70 sources need two 64-lane batches
+    CoordList sources;
+    for (int i = 0; i < 70; ++i) {
+        sources.emplace_back((i * 7) % mapWidth, (i * 3) % mapHeight);
+    }
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev}) {
+        auto maps = generatePerSourceDijkstraMaps(mapWidth, mapHeight, sources, scatteredWalls, distType);
+        ASSERT_EQ(maps.size(), sources.size());
+
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            DijkstraMap expected(mapWidth, mapHeight, distType);
+            generateDijkstraMap(expected, {sources[i]}, scatteredWalls);
+            expectSameDistances(maps[i], expected);
+        }
+    }
+}
+
+TEST_F(MultiSourceTest, InvalidAndDuplicateSources) {
+    auto blockedOrigin = [](int x, int y) {
+        return !(x == 0 && y == 0);
+    };
+    CoordList sources = {{0, 0}, {-3, 2}, {5, 5}, {5, 5}};
+
+    auto maps = generatePerSourceDijkstraMaps(mapWidth, mapHeight, sources, blockedOrigin, DistanceType::Manhattan);
+
+    // Blocked and out-of-bounds sources reach nothing
+    EXPECT_FALSE(maps[0].isReachable(1, 1));
+    EXPECT_FALSE(maps[1].isReachable(0, 2));
+
+    // Duplicate sources get identical maps
+    EXPECT_EQ(maps[2].getDistance(5, 5), 0);
+    EXPECT_EQ(maps[2].getDistance(8, 9), 7);
+    expectSameDistances(maps[3], maps[2]);
+}
+
+TEST_F(MultiSourceTest, OctileFallsBackToSeparateGenerations) {
+    CoordList sources = {{2, 2}, {20, 10}};
+
+    auto maps = generatePerSourceDijkstraMaps(mapWidth, mapHeight, sources, scatteredWalls, DistanceType::Octile);
+
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        DijkstraMap expected(mapWidth, mapHeight, DistanceType::Octile);
+        generateDijkstraMap(expected, {sources[i]}, scatteredWalls);
+        expectSameDistances(maps[i], expected);
+    }
+}
+
+TEST_F(MultiSourceTest, NoSources) {
+    EXPECT_TRUE(generatePerSourceDijkstraMaps(mapWidth, mapHeight, {}, allWalkable).empty());
+}
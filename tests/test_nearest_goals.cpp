@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for K-nearest goal map tests
+class NearestGoalsMapTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 40;
+
+    // Vertical wall at x=20 splits the map into two rooms
+    static bool walkableWithWall(int x, int) {
+        return x != 20;
+    }
+};
+
+TEST_F(NearestGoalsMapTest, SingleSlotMatchesDijkstraMap) {
+    const CoordList goals = {{5, 5}, {33, 20}, {12, 30}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap expected(mapSize, mapSize, distType);
+        generateDijkstraMap(expected, goals, scatteredWalls);
+
+        NearestGoalsMap<1> nearestMap(mapSize, mapSize, distType);
+        generateNearestGoalsMap(nearestMap, goals, scatteredWalls);
+
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                ASSERT_EQ(nearestMap.getDistance(0, x, y), expected.getDistance(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(NearestGoalsMapTest, MatchesSortedPerGoalMaps) {
+    const CoordList goals = {{5, 5}, {33, 20}, {12, 30}, {36, 36}, {3, 7}, {20, 21}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Octile}) {
+        std::vector<DijkstraMap> perGoal;
+        for (const Coord& goal : goals) {
+            perGoal.emplace_back(mapSize, mapSize, distType);
+            generateDijkstraMap(perGoal.back(), {goal}, scatteredWalls);
+        }
+
+        NearestGoalsMap<3> nearestMap(mapSize, mapSize, distType);
+        generateNearestGoalsMap(nearestMap, goals, scatteredWalls);
+
+        for (int y = 0; y < mapSize; ++y) {
+            for (int x = 0; x < mapSize; ++x) {
+                std::vector<std::tuple<int, int>> expected;
+                for (int goal = 0; goal < static_cast<int>(goals.size()); ++goal) {
+                    if (perGoal[goal].isReachable(x, y)) {
+                        expected.emplace_back(perGoal[goal].getDistance(x, y), goal);
+                    }
+                }
+                std::sort(expected.begin(), expected.end());
+                expected.resize(3, {NearestGoalsMap<3>::UNREACHABLE, NearestGoalsMap<3>::NO_GOAL});
+
+                for (int rank = 0; rank < 3; ++rank) {
+                    const auto [distance, goal] = expected[rank];
+                    ASSERT_EQ(nearestMap.getDistance(rank, x, y), distance) << "at " << x << "," << y;
+                    ASSERT_EQ(nearestMap.getGoal(rank, x, y), goal) << "at " << x << "," << y;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(NearestGoalsMapTest, FewerReachableGoalsThanSlots) {
+    // Goal 1 is a wall, goal 2 is behind it, goal 3 shares a tile with goal 0
+    const CoordList goals = {{2, 2}, {20, 5}, {30, 30}, {2, 2}};
+
+    NearestGoalsMap<3> nearestMap(mapSize, mapSize, DistanceType::Manhattan);
+    generateNearestGoalsMap(nearestMap, goals, walkableWithWall);
+
+    EXPECT_EQ(nearestMap.getGoal(0, 5, 6), 0);
+    EXPECT_EQ(nearestMap.getDistance(0, 5, 6), 7);
+    EXPECT_EQ(nearestMap.getGoal(1, 5, 6), 3);
+    EXPECT_EQ(nearestMap.getDistance(1, 5, 6), 7);
+    EXPECT_EQ(nearestMap.getGoal(2, 5, 6), NearestGoalsMap<3>::NO_GOAL);
+    EXPECT_EQ(nearestMap.getDistance(2, 5, 6), NearestGoalsMap<3>::UNREACHABLE);
+
+    EXPECT_EQ(nearestMap.getGoal(0, 25, 30), 2);
+    EXPECT_EQ(nearestMap.getGoal(1, 25, 30), NearestGoalsMap<3>::NO_GOAL);
+    EXPECT_EQ(nearestMap.getGoal(0, 20, 30), NearestGoalsMap<3>::NO_GOAL);
+}
+
+TEST_F(NearestGoalsMapTest, ExtractRankAndBounds) {
+    NearestGoalsMap<2> nearestMap(mapSize, mapSize, DistanceType::Chebyshev);
+    generateNearestGoalsMap(nearestMap, {{0, 0}, {10, 0}}, walkableWithWall);
+
+    DijkstraMap second = nearestMap.extractRank(1);
+    EXPECT_EQ(second.getDistanceType(), DistanceType::Chebyshev);
+    EXPECT_EQ(second.getDistance(4, 3), 6);
+    EXPECT_EQ(nearestMap.getDistance(0, 4, 3), 4);
+
+    EXPECT_EQ(nearestMap.getDistance(2, 4, 3), NearestGoalsMap<2>::UNREACHABLE);
+    EXPECT_EQ(nearestMap.getGoal(-1, 4, 3), NearestGoalsMap<2>::NO_GOAL);
+    EXPECT_EQ(nearestMap.getDistance(0, mapSize, 0), NearestGoalsMap<2>::UNREACHABLE);
+
+    nearestMap.clear();
+    EXPECT_EQ(nearestMap.getGoal(0, 0, 0), NearestGoalsMap<2>::NO_GOAL);
+}
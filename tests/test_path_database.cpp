@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for path database tests
+class PathDatabaseTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 24;
+
+    // Vertical wall at x=12 splits the map into two rooms
+    static bool walkableWithWall(int x, int) {
+        return x != 12;
+    }
+
+    // Length of a path as the sum of its step costs
+    static int pathLength(const CoordList& path, DistanceType distType) {
+        int length = 0;
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            const auto [x, y] = path[i];
+            const auto [previousX, previousY] = path[i - 1];
+            const bool diagonal = x != previousX && y != previousY;
+            length += (distType == DistanceType::Octile) ? (diagonal ? 1414 : 1000) : 1;
+        }
+        return length;
+    }
+};
+
+TEST_F(PathDatabaseTest, PathsAreShortest) {
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        PathDatabase database = buildPathDatabase(mapSize, mapSize, scatteredWalls, distType, 2);
+        const bool diagonal = distType != DistanceType::Manhattan;
+
+        for (const Coord& goal : CoordList{{1, 2}, {20, 15}}) {
+            DijkstraMap map(mapSize, mapSize, distType);
+            generateDijkstraMap(map, {goal}, scatteredWalls);
+
+            for (int y = 0; y < mapSize; ++y) {
+                for (int x = 0; x < mapSize; ++x) {
+                    CoordList path = extractPath(database, {x, y}, goal);
+                    if (!map.isReachable(x, y)) {
+                        EXPECT_TRUE(path.empty());
+                        continue;
+                    }
+
+                    ASSERT_FALSE(path.empty()) << "from " << x << "," << y;
+                    EXPECT_EQ(path.front(), Coord(x, y));
+                    EXPECT_EQ(path.back(), goal);
+                    EXPECT_EQ(pathLength(path, distType), map.getDistance(x, y));
+                    for (std::size_t i = 1; i < path.size(); ++i) {
+                        const auto [stepX, stepY] = path[i];
+                        const auto [previousX, previousY] = path[i - 1];
+                        EXPECT_TRUE(scatteredWalls(stepX, stepY));
+                        EXPECT_TRUE(diagonal || std::abs(stepX - previousX) + std::abs(stepY - previousY) == 1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(PathDatabaseTest, ThreadCountDoesNotChangeTables) {
+    PathDatabase single = buildPathDatabase(mapSize, mapSize, scatteredWalls, DistanceType::Octile, 1);
+    PathDatabase parallel = buildPathDatabase(mapSize, mapSize, scatteredWalls, DistanceType::Octile, 4);
+
+    ASSERT_EQ(single.getRowCount(), mapSize * mapSize);
+    ASSERT_EQ(parallel.getRunCount(), single.getRunCount());
+    for (int goal = 0; goal < mapSize * mapSize; goal += 7) {
+        for (int from = 0; from < mapSize * mapSize; ++from) {
+            ASSERT_EQ(parallel.getFirstMove(from % mapSize, from / mapSize, goal % mapSize, goal / mapSize),
+                      single.getFirstMove(from % mapSize, from / mapSize, goal % mapSize, goal / mapSize));
+        }
+    }
+}
+
+TEST_F(PathDatabaseTest, OpenMapCompressesToFewRunsPerRow) {
+    PathDatabase database = buildPathDatabase(mapSize, mapSize, allWalkable, DistanceType::Manhattan);
+
+    // Down above the goal, right then left on its row, and up below it
+    EXPECT_EQ(database.getRowRunCount(10, 10), 4);
+    EXPECT_LE(database.getRunCount(), 4 * mapSize * mapSize);
+    EXPECT_EQ(database.getFirstMove(10, 3, 10, 10), 0);
+    EXPECT_EQ(database.getFirstMove(2, 10, 10, 10), 2);
+}
+
+TEST_F(PathDatabaseTest, BlockedAndUnconnectedTiles) {
+    PathDatabase database = buildPathDatabase(mapSize, mapSize, walkableWithWall, DistanceType::Chebyshev);
+
+    EXPECT_TRUE(extractPath(database, {0, 0}, {20, 20}).empty());
+    EXPECT_TRUE(extractPath(database, {0, 0}, {12, 5}).empty());
+    EXPECT_TRUE(extractPath(database, {-1, 0}, {5, 5}).empty());
+    EXPECT_EQ(extractPath(database, {4, 4}, {4, 4}).size(), 1u);
+    EXPECT_EQ(extractPath(database, {0, 0}, {11, 23}).size(), 24u);
+
+    EXPECT_EQ(database.getFirstMove(0, 0, 20, 20), PathDatabase::NO_MOVE);
+    EXPECT_EQ(database.getFirstMove(12, 0, 5, 5), PathDatabase::NO_MOVE);
+    EXPECT_EQ(database.getFirstMove(0, 0, mapSize, 0), PathDatabase::NO_MOVE);
+    EXPECT_EQ(database.getRowRunCount(12, 3), 0);
+}
+
+TEST_F(PathDatabaseTest, MapsOverTileLimitAreRejected) {
+    int calls = 0;
+    auto counted = [&calls](int, int) {
+        ++calls;
+        return true;
+    };
+
+    // 2^29 tiles cannot be packed beside a move, so nothing is built or even asked
+    PathDatabase database = buildPathDatabase(1 << 15, 1 << 14, counted, DistanceType::Manhattan);
+    EXPECT_EQ(database.getDimensions(), std::make_tuple(0, 0));
+    EXPECT_EQ(database.getRowCount(), 0);
+    EXPECT_EQ(calls, 0);
+    EXPECT_TRUE(extractPath(database, {0, 0}, {1, 0}).empty());
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for bit-parallel reachability tests
+class ReachabilityTest : public ::testing::Test {
+protected:
+    // Serpentine corridor: horizontal walls with a gap alternating between the ends
+    static bool serpentine(int x, int y) {
+        constexpr int width = 130;
+        if (y % 2 == 0) {
+            return true;
+        }
+        return (y % 4 == 1) ? (x == width - 1) : (x == 0);
+    }
+
+    // Reachability expected from a full Dijkstra map
+    template<typename WalkableFunc>
+    static void expectMatchesDijkstra(int width, int height, const CoordList& goals,
+                                      WalkableFunc isWalkable, DistanceType distType) {
+        DijkstraMap map(width, height, distType);
+        generateDijkstraMap(map, goals, isWalkable);
+        BitGrid reachable = computeReachable(width, height, goals, isWalkable, distType);
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                ASSERT_EQ(reachable.get(x, y), map.isReachable(x, y)) << "at (" << x << ", " << y << ")";
+            }
+        }
+    }
+};
+
+TEST_F(ReachabilityTest, BuildWalkabilityGrid) {
+    BitGrid walkable = buildWalkabilityGrid(70, 3, [](int x, int y) { return x == y || x == 69; });
+
+    EXPECT_EQ(walkable.count(), 6);
+    EXPECT_TRUE(walkable.get(2, 2));
+    EXPECT_TRUE(walkable.get(69, 0));
+    EXPECT_FALSE(walkable.get(1, 0));
+}
+
+TEST_F(ReachabilityTest, OpenMapIsFullyReachable) {
+    BitGrid reachable = computeReachable(100, 20, {{50, 10}}, allWalkable);
+
+    EXPECT_EQ(reachable.count(), 100 * 20);
+}
+
+TEST_F(ReachabilityTest, NoGoalsOrBlockedGoals) {
+    EXPECT_EQ(computeReachable(10, 10, {}, allWalkable).count(), 0);
+    EXPECT_EQ(computeReachable(10, 10, {{-1, 0}, {10, 10}}, allWalkable).count(), 0);
+    EXPECT_EQ(computeReachable(10, 10, {{5, 5}}, [](int x, int y) { return !(x == 5 && y == 5); }).count(), 0);
+}
+
+TEST_F(ReachabilityTest, MatchesDijkstraOnScatteredWalls) {
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev}) {
+        expectMatchesDijkstra(150, 40, {{1, 1}, {120, 30}}, scatteredWalls, distType);
+    }
+}
+
+TEST_F(ReachabilityTest, SerpentineCorridorNeedsManySweeps) {
+    constexpr int width = 130;
+    constexpr int height = 33;
+
+    BitGrid reachable = computeReachable(width, height, {{0, 0}}, serpentine);
+
+    EXPECT_TRUE(reachable.get(width - 1, height - 1));
+    EXPECT_FALSE(reachable.get(5, 1));
+    expectMatchesDijkstra(width, height, {{0, 0}}, serpentine, DistanceType::Manhattan);
+}
+
+TEST_F(ReachabilityTest, DiagonalGapsOnlyConnectWithEightDirections) {
+    // Checkerboard: tiles only touch diagonally
+    auto checkerboard = [](int x, int y) {
+        return (x + y) % 2 == 0;
+    };
+
+    EXPECT_EQ(computeReachable(70, 4, {{0, 0}}, checkerboard, DistanceType::Manhattan).count(), 1);
+    EXPECT_EQ(computeReachable(70, 4, {{0, 0}}, checkerboard, DistanceType::Chebyshev).count(), 70 * 4 / 2);
+}
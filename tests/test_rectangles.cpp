@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+#include "test_maps.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for rectangle decomposition tests
+class RectangleDecompositionTest : public ::testing::Test {
+protected:
+    // Dungeon of 10x10 rooms joined by doors in the dividing walls
+    static bool rooms(int x, int y) {
+        const bool wallColumn = x % 11 == 10;
+        const bool wallRow = y % 11 == 10;
+        if (wallColumn && wallRow) {
+            return false;
+        }
+        if (wallColumn) {
+            return y % 11 == 4;
+        }
+        if (wallRow) {
+            return x % 11 == 6;
+        }
+        return true;
+    }
+};
+
+TEST_F(RectangleDecompositionTest, OpenMapIsSingleRectangle) {
+    RectangleDecomposition decomposition = decomposeIntoRectangles(12, 7, allWalkable);
+
+    ASSERT_EQ(decomposition.getRectangleCount(), 1);
+    const auto& rectangle = decomposition.getRectangle(0);
+    EXPECT_EQ(rectangle.x, 0);
+    EXPECT_EQ(rectangle.y, 0);
+    EXPECT_EQ(rectangle.width, 12);
+    EXPECT_EQ(rectangle.height, 7);
+    EXPECT_EQ(decomposition.getRectangleId(11, 6), 0);
+    EXPECT_EQ(decomposition.getRectangleId(12, 6), RectangleDecomposition::NO_RECTANGLE);
+}
+
+TEST_F(RectangleDecompositionTest, RectanglesCoverWalkableTilesExactlyOnce) {
+    constexpr int size = 40;
+    RectangleDecomposition decomposition = decomposeIntoRectangles(size, size, scatteredWalls);
+
+    std::vector<int> coverCount(size * size, 0);
+    for (int id = 0; id < decomposition.getRectangleCount(); ++id) {
+        const auto& rectangle = decomposition.getRectangle(id);
+        for (int y = rectangle.y; y < rectangle.y + rectangle.height; ++y) {
+            for (int x = rectangle.x; x < rectangle.x + rectangle.width; ++x) {
+                ASSERT_TRUE(scatteredWalls(x, y));
+                EXPECT_EQ(decomposition.getRectangleId(x, y), id);
+                ++coverCount[y * size + x];
+            }
+        }
+    }
+
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            EXPECT_EQ(coverCount[y * size + x], scatteredWalls(x, y) ? 1 : 0);
+        }
+    }
+}
+
+TEST_F(RectangleDecompositionTest, RoomsNeedFewRectangles) {
+    constexpr int size = 43;
+    RectangleDecomposition decomposition = decomposeIntoRectangles(size, size, rooms);
+
+    // 16 rooms and 24 doors; a door growing down into the room below splits that room
+    EXPECT_LE(decomposition.getRectangleCount(), 16 * 2 + 24);
+}
+
+TEST_F(RectangleDecompositionTest, GenerationMatchesFloodFill) {
+    constexpr int size = 43;
+    CoordList goals = {{1, 1}, {30, 20}, {10, 10}};
+
+    for (bool (*walkable)(int, int) : {scatteredWalls, rooms}) {
+        RectangleDecomposition decomposition = decomposeIntoRectangles(size, size, walkable);
+
+        for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev,
+                                      DistanceType::Euclidean, DistanceType::Octile}) {
+            DijkstraMap expected(size, size, distType);
+            DijkstraMap actual(size, size, distType);
+            generateDijkstraMap(expected, goals, walkable);
+            generateDijkstraMapFromRectangles(actual, decomposition, goals);
+
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y)) << "at " << x << "," << y;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "DijkstraMapLib.hpp"
+
+using namespace DijkstraMapLib;
+
+// Test fixture for weighted Dijkstra map tests
+class WeightedDijkstraMapTest : public ::testing::Test {
+protected:
+    static constexpr int mapSize = 40;
+
+    static int uniformCost(int, int) {
+        return 1;
+    }
+
+    // Smooth terrain: cost rises toward the map center, with a few walls
+    static int hillCost(int x, int y) {
+        if (x == 20 && y > 5 && y < 35) {
+            return -1;
+        }
+        const int dx = x - 20;
+        const int dy = y - 20;
+        return 1 + (800 - std::min(800, dx * dx + dy * dy)) / 100;
+    }
+
+    static void expectMapsEqual(const DijkstraMap& expected, const DijkstraMap& actual) {
+        const auto [width, height] = expected.getDimensions();
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                ASSERT_EQ(actual.getDistance(x, y), expected.getDistance(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+};
+
+TEST_F(WeightedDijkstraMapTest, UniformCostMatchesUnweightedMap) {
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap expected(mapSize, mapSize, distType);
+        DijkstraMap actual(mapSize, mapSize, distType);
+        generateDijkstraMap(expected, {{3, 7}}, [](int, int) { return true; });
+        generateWeightedDijkstraMap(actual, {{3, 7}}, uniformCost);
+
+        expectMapsEqual(expected, actual);
+    }
+}
+
+TEST_F(WeightedDijkstraMapTest, ExpensiveTilesAreAvoided) {
+    // Swamp column at x=2 costs 10 except for a gap at the bottom
+    auto swamp = [](int x, int y) {
+        return (x == 2 && y < 4) ? 10 : 1;
+    };
+
+    DijkstraMap map(5, 5, DistanceType::Manhattan);
+    generateWeightedDijkstraMap(map, {{0, 0}}, swamp);
+
+    EXPECT_EQ(map.getDistance(1, 0), 1);
+    EXPECT_EQ(map.getDistance(2, 0), 11);
+    // Detour through the gap (11 steps) beats crossing the swamp (1 + 10 + 1)
+    EXPECT_EQ(map.getDistance(3, 0), 11);
+    EXPECT_EQ(map.getDistance(4, 4), 8);
+}
+
+TEST_F(WeightedDijkstraMapTest, NegativeCostIsImpassable) {
+    auto wall = [](int x, int) {
+        return x == 2 ? -1 : 1;
+    };
+
+    DijkstraMap map(5, 5, DistanceType::Manhattan);
+    generateWeightedDijkstraMap(map, {{0, 0}, {2, 2}}, wall);
+
+    EXPECT_EQ(map.getDistance(1, 4), 5);
+    EXPECT_FALSE(map.isReachable(2, 2));
+    EXPECT_FALSE(map.isReachable(3, 0));
+}
+
+TEST_F(WeightedDijkstraMapTest, SweepingConvergesToHeapResult) {
+    CoordList goals = {{2, 2}, {37, 30}};
+
+    for (DistanceType distType : {DistanceType::Manhattan, DistanceType::Chebyshev, DistanceType::Octile}) {
+        DijkstraMap expected(mapSize, mapSize, distType);
+        DijkstraMap actual(mapSize, mapSize, distType);
+        generateWeightedDijkstraMap(expected, goals, hillCost);
+        SweepResult result = generateWeightedDijkstraMapBySweeping(actual, goals, hillCost);
+
+        EXPECT_TRUE(result.converged);
+        EXPECT_LT(result.iterations, 10);
+        expectMapsEqual(expected, actual);
+    }
+}
+
+TEST_F(WeightedDijkstraMapTest, SweepingReportsIterationCap) {
+    // Serpentine corridor needs one iteration per turn
+    auto serpentine = [](int x, int y) {
+        if (y % 2 == 0) {
+            return 1;
+        }
+        return (((y / 2) % 2 == 0) ? x == 9 : x == 0) ? 1 : -1;
+    };
+
+    DijkstraMap capped(10, 20, DistanceType::Manhattan);
+    SweepResult result = generateWeightedDijkstraMapBySweeping(capped, {{0, 19}}, serpentine, SweepOptions{1});
+    EXPECT_FALSE(result.converged);
+    EXPECT_EQ(result.iterations, 1);
+
+    DijkstraMap exact(10, 20, DistanceType::Manhattan);
+    generateWeightedDijkstraMap(exact, {{0, 19}}, serpentine);
+    for (int y = 0; y < 20; ++y) {
+        for (int x = 0; x < 10; ++x) {
+            // Capped distances are path lengths, never shorter than the exact ones
+            EXPECT_GE(capped.getDistance(x, y), exact.getDistance(x, y));
+        }
+    }
+}
+
+TEST_F(WeightedDijkstraMapTest, OverflowingPathLengthsAreUnreachable) {
+    // One Octile step onto a 2000000-cost tile fits in an int, two do not
+    auto steep = [](int x, int) {
+        return (x == 0) ? 1 : 2000000;
+    };
+
+    DijkstraMap heap(3, 1, DistanceType::Octile);
+    DijkstraMap swept(3, 1, DistanceType::Octile);
+    generateWeightedDijkstraMap(heap, {{0, 0}}, steep);
+    SweepResult result = generateWeightedDijkstraMapBySweeping(swept, {{0, 0}}, steep);
+
+    EXPECT_TRUE(result.converged);
+    EXPECT_EQ(heap.getDistance(1, 0), 2000000000);
+    EXPECT_FALSE(heap.isReachable(2, 0));
+    expectMapsEqual(heap, swept);
+}